@@ -18,6 +18,7 @@
 #include "UObject/ObjectSaveContext.h"
 
 // Core
+#include "Algo/AllOf.h"
 #include "Logging/MessageLog.h"
 #include "Logging/StructuredLog.h"
 
@@ -32,34 +33,51 @@ UDataDefinitionLibrary* UDataDefinitionLibrary::GetInstance( void )
 
 void UDataDefinitionLibrary::AddDefinitionInternal( const UDataDefinition *Definition )
 {
-	const auto AssetType = UPrimaryDataAsset::StaticClass( );
-	const auto InterfaceBase = UInterface::StaticClass( );
+	// Buckets are determined entirely by the class, so an active definition is already in every bucket it belongs in
+	bool bAlreadyActive = false;
+	ActiveDefinitions.Add( Definition, &bAlreadyActive );
 
-	auto Type = Definition->GetClass( );
-	while (Type != AssetType)
+	if (!bAlreadyActive)
 	{
-		if (Type->IsNative())
+		const auto AssetType = UPrimaryDataAsset::StaticClass( );
+		const auto InterfaceBase = UInterface::StaticClass( );
+
+		// Interfaces can be reached more than once through the hierarchy, track which buckets have been handled
+		// so that the buckets can be a plain Add instead of a linear AddUnique search
+		TSet< FName, DefaultKeyFuncs< FName >, TInlineSetAllocator< 16 > > VisitedBuckets;
+
+		auto Type = Definition->GetClass( );
+		while (Type != AssetType)
 		{
-			auto &Definitions = LibraryTypeMap.FindOrAdd( Type->GetFName() );
-			Definitions.AddUnique( Definition );
-			
-			for (const auto &FII : Type->Interfaces)
+			if (Type->IsNative())
 			{
-				auto InterfaceClass = FII.Class;
-				while (InterfaceClass != InterfaceBase)
+				auto &Definitions = LibraryTypeMap.FindOrAdd( Type->GetFName() );
+				Definitions.Add( Definition );
+				
+				for (const auto &FII : Type->Interfaces)
 				{
-					if (InterfaceClass->IsNative( ))
+					auto InterfaceClass = FII.Class;
+					while (InterfaceClass != InterfaceBase)
 					{
-						auto &InterfaceDefinitions = LibraryTypeMap.FindOrAdd( InterfaceClass->GetFName( ) );
-						InterfaceDefinitions.AddUnique( Definition );
-					}
+						bool bAlreadyVisited = false;
+						VisitedBuckets.Add( InterfaceClass->GetFName( ), &bAlreadyVisited );
 
-					InterfaceClass = InterfaceClass->GetSuperClass( );
+						if (bAlreadyVisited)
+							break; // the rest of this interface's hierarchy has been handled too
+
+						if (InterfaceClass->IsNative( ))
+						{
+							auto &InterfaceDefinitions = LibraryTypeMap.FindOrAdd( InterfaceClass->GetFName( ) );
+							InterfaceDefinitions.Add( Definition );
+						}
+
+						InterfaceClass = InterfaceClass->GetSuperClass( );
+					}
 				}
 			}
-		}
 
-		Type = Type->GetSuperClass( );
+			Type = Type->GetSuperClass( );
+		}
 	}
 
 	// Apply any pending extensions that should affect this asset
@@ -69,7 +87,9 @@ void UDataDefinitionLibrary::AddDefinitionInternal( const UDataDefinition *Defin
 		PendingExtensions.Remove( Definition );
 	}
 
-	ActiveDefinitions.Add( Definition );
+	const auto AssetID = Definition->GetPrimaryAssetId( );
+	DefinitionIDIndex.Add( AssetID, Definition );
+	DefinitionNameIndex.AddUnique( AssetID.PrimaryAssetName, AssetID );
 
 	Definition->OnAssetLoaded( );
 }
@@ -119,6 +139,10 @@ void UDataDefinitionLibrary::RemoveDefinitionInternal( const UDataDefinition *De
 
 	ActiveDefinitions.Remove( Definition );
 
+	const auto AssetID = Definition->GetPrimaryAssetId( );
+	DefinitionIDIndex.Remove( AssetID );
+	DefinitionNameIndex.RemoveSingle( AssetID.PrimaryAssetName, AssetID );
+
 	Definition->OnAssetUnloaded( );
 }
 
@@ -165,14 +189,20 @@ void UDataDefinitionLibrary::RemoveDefinitionExtensions( const UDataDefinitionEx
 
 void UDataDefinitionLibrary::GetAllDefinitionsForType( const UClass *ClassType, TArray< const UDataDefinition* > &outArray ) const
 {
-	outArray.Empty( );
+	const auto View = GetDefinitionsViewForType( ClassType );
+
+	outArray.Reset( View.Num( ) );
+	outArray.Append( View.GetData( ), View.Num( ) );
+}
 
+TConstArrayView< const UDataDefinition* > UDataDefinitionLibrary::GetDefinitionsViewForType( const UClass *ClassType ) const
+{
 	const auto TypeMap = LibraryTypeMap.Find( ClassType->GetFName( ) );
 
 	if (TypeMap == nullptr)
-		return;
+		return { };
 
-	outArray = *TypeMap;
+	return ObjectPtrDecay( *TypeMap );
 }
 
 void UDataDefinitionLibrary::GetAllDefinitionIDsForType( const UClass *ClassType, TArray< FPrimaryAssetId > &outArray ) const
@@ -195,56 +225,99 @@ void UDataDefinitionLibrary::GetAllDefinitionIDsForType( const UClass *ClassType
 
 const UDataDefinition* UDataDefinitionLibrary::FindDefinition( const UClass *ClassType, const FName &AssetName ) const
 {
-	const auto Set = LibraryTypeMap.Find( ClassType->GetFName( ) );
-
-	if (Set == nullptr)
+	// Only native types have buckets, so those are the only types that lookups can succeed for
+	if (!LibraryTypeMap.Contains( ClassType->GetFName( ) ))
 		return nullptr;
 
-	for (const auto& Definition : *Set)
+	const bool bInterface = ClassType->HasAnyClassFlags( CLASS_Interface );
+
+	// Almost always a single entry, but asset names are only unique per primary asset type
+	for (auto It = DefinitionNameIndex.CreateConstKeyIterator( AssetName ); It; ++It)
 	{
-		if (Definition->GetPrimaryAssetId().PrimaryAssetName == AssetName)
+		const auto Definition = FindDefinition( It.Value( ) );
+		if (Definition == nullptr)
+			continue;
+
+		if (bInterface ? Definition->GetClass( )->ImplementsInterface( ClassType ) : Definition->IsA( ClassType ))
 			return Definition;
 	}
 
 	return nullptr;
 }
 
+const UDataDefinition* UDataDefinitionLibrary::FindDefinition( const FPrimaryAssetId &AssetID ) const
+{
+	if (const auto Found = DefinitionIDIndex.Find( AssetID ))
+		return *Found;
+
+	return nullptr;
+}
+
 void UDataDefinitionLibrary::GetPrimaryAssetDependencies( const FPrimaryAssetId &AssetID, TSet< FPrimaryAssetId > &OutDependencies, const TArray< FName > &BundleNames ) const
 {
-	if (OutDependencies.Contains( AssetID ))
-		return;
-	OutDependencies.Add( AssetID );
+	static const FPrimaryAssetType DataDefinitionType( "DataDefinition" );
 
-	TSet< FSoftObjectPath > Paths;
-	GetPrimaryAssetLoadSet( Paths, AssetID, BundleNames, true );
+	TArray< FPrimaryAssetId, TInlineAllocator< 32 > > ToVisit;
+	ToVisit.Push( AssetID );
 
-	for (const auto &P : Paths)
+	while (!ToVisit.IsEmpty( ))
 	{
-		const auto Dependency = GetPrimaryAssetIdForPath( P );
+		const auto ID = ToVisit.Pop( );
 
-		if (!Dependency.IsValid( ))
+		bool bAlreadyVisited = false;
+		OutDependencies.Add( ID, &bAlreadyVisited );
+		if (bAlreadyVisited)
 			continue;
 
-		GetPrimaryAssetDependencies( Dependency, OutDependencies, BundleNames );
-	}
+		for (const auto &Bundle : BundleNames)
+			ToVisit.Append( GetBundleDependencies( ID, Bundle ) );
 
-	// Add in active asset extensions which are dynamic dependencies of DataDefinitions
-	static const FPrimaryAssetType DataDefinitionType( "DataDefinition" );
-	if (AssetID.PrimaryAssetType == DataDefinitionType)
-	{
-		const auto DataDefinition = GetDefinition< UDataDefinition >( AssetID );
-		if (ensureAlways( DataDefinition != nullptr ))
+		// Add in active asset extensions which are dynamic dependencies of DataDefinitions
+		if (ID.PrimaryAssetType == DataDefinitionType)
 		{
-			for (const auto& Extension : DataDefinition->ActiveExtensions)
+			const auto DataDefinition = GetDefinition< UDataDefinition >( ID );
+			if (ensureAlways( DataDefinition != nullptr ))
 			{
-				const auto ExtensionID = Extension->GetPrimaryAssetId( );
-
-				GetPrimaryAssetDependencies( ExtensionID, OutDependencies, BundleNames );
+				for (const auto& Extension : DataDefinition->ActiveExtensions)
+					ToVisit.Push( Extension->GetPrimaryAssetId( ) );
 			}
 		}
 	}
 }
 
+const TArray< FPrimaryAssetId >& UDataDefinitionLibrary::GetBundleDependencies( const FPrimaryAssetId &AssetID, const FName &BundleName ) const
+{
+	auto &BundleDependencies = DependencyCache.FindOrAdd( AssetID );
+	if (const auto Cached = BundleDependencies.Find( BundleName ))
+		return *Cached;
+
+	TSet< FSoftObjectPath > Paths;
+	GetPrimaryAssetLoadSet( Paths, AssetID, { BundleName }, true );
+
+	TArray< FPrimaryAssetId > Dependencies;
+	for (const auto &P : Paths)
+	{
+		const auto Dependency = GetPrimaryAssetIdForPath( P );
+
+		if (!Dependency.IsValid( ) || (Dependency == AssetID))
+			continue;
+
+		Dependencies.AddUnique( Dependency );
+	}
+
+	return BundleDependencies.Add( BundleName, MoveTemp( Dependencies ) );
+}
+
+void UDataDefinitionLibrary::InvalidateDependencyCache( const FPrimaryAssetId &AssetID )
+{
+	DependencyCache.Remove( AssetID );
+}
+
+void UDataDefinitionLibrary::InvalidateDependencyCache( void )
+{
+	DependencyCache.Empty( );
+}
+
 TSharedPtr<FStreamableHandle> UDataDefinitionLibrary::LoadPrimaryAssets(const TArray<FPrimaryAssetId>& AssetsToLoad, const TArray<FName>& LoadBundles, FAssetManagerLoadParams&& LoadParams, UE::FSourceLocation Location)
 {
 	// Overridden to change the bRemoveAllBundles param from true to false. Unloading bundles not in the LoadBundles when doing LoadPrimaryAssets seems bonkers
@@ -252,92 +325,169 @@ TSharedPtr<FStreamableHandle> UDataDefinitionLibrary::LoadPrimaryAssets(const TA
 	return ChangeBundleStateForPrimaryAssets(AssetsToLoad, LoadBundles, TArray<FName>(), false, MoveTemp(LoadParams), MoveTemp(Location));
 }
 
+int UDataDefinitionLibrary::InternBundleName( const FName &BundleName )
+{
+	if (const auto Found = BundleNameIndices.Find( BundleName ))
+		return *Found;
+
+	const int Index = BundleNameTable.Add( BundleName );
+	BundleNameIndices.Add( BundleName, Index );
+
+	return Index;
+}
+
 void UDataDefinitionLibrary::IncrementRefCounts( const TSet< FPrimaryAssetId > &Assets, const TArray< FName > &BundleNames, const FPrimaryAssetId &SourceID )
 {
-	if (Assets.IsEmpty())
+	TArray< FBundleRefChange > Changes;
+	Changes.Reserve( Assets.Num( ) );
+
+	for (const FPrimaryAssetId &ID : Assets)
+		Changes.Add( { ID, SourceID } );
+
+	IncrementRefCounts( Changes, BundleNames );
+}
+
+void UDataDefinitionLibrary::IncrementRefCounts( TConstArrayView< FBundleRefChange > Changes, const TArray< FName > &BundleNames )
+{
+	if (Changes.IsEmpty())
 		return;
 	if (BundleNames.IsEmpty())
 		return;
 
-	ensureAlways( SourceID.IsValid( ) );
+	TArray< int, TInlineAllocator< 8 > > BundleIndices;
+	for (const FName &Bundle : BundleNames)
+		BundleIndices.Push( InternBundleName( Bundle ) );
 
-	for (const FPrimaryAssetId &ID : Assets)
+	for (const FBundleRefChange &Change : Changes)
 	{
-		FBundleData &BundleData = PrimaryAssetBundleCounts.FindOrAdd( ID );
+		ensureAlways( Change.SourceID.IsValid( ) );
+
+		FBundleData &BundleData = PrimaryAssetBundleCounts.FindOrAdd( Change.AssetID );
 
-		for (const FName &Bundle : BundleNames)
+		for (const int BundleIndex : BundleIndices)
 		{
-			FBundleCounts &Count = BundleData.FindOrAdd( Bundle );
+			FBundleCount *Count = BundleData.FindByPredicate( [ BundleIndex ]( const FBundleCount &C ) -> bool { return C.BundleIndex == BundleIndex; } );
+			if (Count == nullptr)
+			{
+				Count = &BundleData.AddDefaulted_GetRef( );
+				Count->BundleIndex = BundleIndex;
+			}
+
+			++Count->RefCount;
 
-			++Count.RefCount;
+			auto SourceCount = Count->RefSources.FindByPredicate( [ &Change ]( const TPair< FPrimaryAssetId, int > &S ) -> bool { return S.Key == Change.SourceID; } );
+			if (SourceCount == nullptr)
+				SourceCount = &Count->RefSources.Emplace_GetRef( Change.SourceID, 0 );
 
-			int &SourceCount = Count.RefSources.FindOrAdd( SourceID );
-			++SourceCount;
+			++SourceCount->Value;
 		}
 	}
 }
 
 TSharedPtr< FStreamableHandle > UDataDefinitionLibrary::DecrementRefCountsAndUnload( const TSet< FPrimaryAssetId > &Assets, const TArray< FName > &BundleNames, const FPrimaryAssetId &SourceID )
 {
-	if (Assets.IsEmpty())
+	TArray< FBundleRefChange > Changes;
+	Changes.Reserve( Assets.Num( ) );
+
+	for (const FPrimaryAssetId &ID : Assets)
+		Changes.Add( { ID, SourceID } );
+
+	return DecrementRefCountsAndUnload( Changes, BundleNames );
+}
+
+TSharedPtr< FStreamableHandle > UDataDefinitionLibrary::DecrementRefCountsAndUnload( TConstArrayView< FBundleRefChange > Changes, const TArray< FName > &BundleNames )
+{
+	if (Changes.IsEmpty())
 		return { };
 	if (BundleNames.IsEmpty( ))
 		return { };
-	
-	ensureAlways( SourceID.IsValid( ) );
 
-	TArray< TSharedPtr< FStreamableHandle > > AllHandles;
+	TArray< int, TInlineAllocator< 8 > > BundleIndices;
+	for (const FName &Bundle : BundleNames)
+		BundleIndices.Push( InternBundleName( Bundle ) );
 
-	for (const FPrimaryAssetId &ID : Assets)
+	// The bundles (by index) that are no longer referenced for each asset
+	typedef TArray< int, TInlineAllocator< 4 > > FBundleIndexList;
+	TMap< FPrimaryAssetId, FBundleIndexList > ZeroCountBundles;
+
+	for (const FBundleRefChange &Change : Changes)
 	{
-		FBundleData &BundleData = PrimaryAssetBundleCounts.FindOrAdd( ID );
+		const FPrimaryAssetId &ID = Change.AssetID;
+		const FPrimaryAssetId &SourceID = Change.SourceID;
+
+		ensureAlways( SourceID.IsValid( ) );
 
-		TArray< FName > ZeroCountBundles;
-		for (const FName &Bundle : BundleNames)
+		FBundleData *BundleData = PrimaryAssetBundleCounts.Find( ID );
+
+		for (int x = 0; x < BundleIndices.Num( ); ++x)
 		{
-			if (FBundleCounts *FoundCount = BundleData.Find( Bundle ))
+			const int BundleIndex = BundleIndices[ x ];
+			const FName &Bundle = BundleNames[ x ];
+
+			const int CountIndex = (BundleData != nullptr) ? BundleData->IndexOfByPredicate( [ BundleIndex ]( const FBundleCount &C ) -> bool { return C.BundleIndex == BundleIndex; } ) : INDEX_NONE;
+			if (CountIndex == INDEX_NONE)
 			{
-				if (FoundCount->RefCount == 0)
-				{
-					UE_LOGFMT( LogDefinitionLibrary, Log, "RefCount 0 found while decrementing references for asset:{0} bundle:{1}. Did something get mismatched? or someone not careful with bundle change calls?", ID.PrimaryAssetName, Bundle );
-					continue;
-				}
+				UE_LOGFMT( LogDefinitionLibrary, Log, "No RefCount information found while decrementing references for asset:{0} bundle:{1}. Did something get mismatched? or someone not careful with bundle change calls?", ID.PrimaryAssetName, Bundle );
+				continue;
+			}
 
-				if (int *SourceRefCount = FoundCount->RefSources.Find( ID ))
-				{
-					if (*SourceRefCount > 0)
-					{
-						--(*SourceRefCount);
-						if ((*SourceRefCount)==0)
-							FoundCount->RefSources.Remove( ID );
-					}
-					else
-					{
-						UE_LOGFMT( LogDefinitionLibrary, Log, "RefCount 0 found while decrementing references for asset:{0} bundle:{1} source:{2}. Did something get mismatched? or someone not careful with bundle change calls?", ID.PrimaryAssetName, Bundle, SourceID.PrimaryAssetName );
-					}
-				}
+			FBundleCount &Count = (*BundleData)[ CountIndex ];
+			if (Count.RefCount == 0)
+			{
+				UE_LOGFMT( LogDefinitionLibrary, Log, "RefCount 0 found while decrementing references for asset:{0} bundle:{1}. Did something get mismatched? or someone not careful with bundle change calls?", ID.PrimaryAssetName, Bundle );
+				continue;
+			}
 
-				--FoundCount->RefCount;
-				if (FoundCount->RefCount == 0)
-				{
-					ZeroCountBundles.Push( Bundle );
-					BundleData.Remove( Bundle );
-				}
+			const int SourceIndex = Count.RefSources.IndexOfByPredicate( [ &SourceID ]( const TPair< FPrimaryAssetId, int > &S ) -> bool { return S.Key == SourceID; } );
+			if (SourceIndex != INDEX_NONE)
+			{
+				--Count.RefSources[ SourceIndex ].Value;
+				if (Count.RefSources[ SourceIndex ].Value == 0)
+					Count.RefSources.RemoveAtSwap( SourceIndex );
 			}
 			else
 			{
-				UE_LOGFMT( LogDefinitionLibrary, Log, "No RefCount information found while decrementing references for asset:{0} bundle:{1}. Did something get mismatched? or someone not careful with bundle change calls?", ID.PrimaryAssetName, Bundle );
-				continue;
+				UE_LOGFMT( LogDefinitionLibrary, Log, "RefCount 0 found while decrementing references for asset:{0} bundle:{1} source:{2}. Did something get mismatched? or someone not careful with bundle change calls?", ID.PrimaryAssetName, Bundle, SourceID.PrimaryAssetName );
 			}
-		}
 
-		// Make a state change for just this asset based on the specific bundles that are no longer needed for it (if any)
-		if (!ZeroCountBundles.IsEmpty( ))
-		{
-			TSharedPtr< FStreamableHandle > UnloadHandle = Super::ChangeBundleStateForPrimaryAssets( { ID }, { }, ZeroCountBundles, false );
-			if (UnloadHandle.IsValid( ) && UnloadHandle->IsActive( ))
-				AllHandles.Push( UnloadHandle );
+			--Count.RefCount;
+			if (Count.RefCount == 0)
+			{
+				ZeroCountBundles.FindOrAdd( ID ).Push( BundleIndex );
+				BundleData->RemoveAtSwap( CountIndex );
+			}
 		}
+
+		if ((BundleData != nullptr) && BundleData->IsEmpty( ))
+			PrimaryAssetBundleCounts.Remove( ID );
+	}
+
+	// Group the assets that need the exact same bundles unloaded so that they can share a single state change
+	// There are only ever a handful of distinct bundle combinations, so a linear search of the batches is fine
+	TArray< TPair< FBundleIndexList, TArray< FPrimaryAssetId > > > Batches;
+	for (auto &Entry : ZeroCountBundles)
+	{
+		Entry.Value.Sort( );
+
+		auto Batch = Batches.FindByPredicate( [ &Entry ]( const TPair< FBundleIndexList, TArray< FPrimaryAssetId > > &B ) -> bool { return B.Key == Entry.Value; } );
+		if (Batch == nullptr)
+			Batch = &Batches.Emplace_GetRef( Entry.Value, TArray< FPrimaryAssetId >( ) );
+
+		Batch->Value.Push( Entry.Key );
+	}
+
+	TArray< TSharedPtr< FStreamableHandle > > AllHandles;
+
+	for (const auto &Batch : Batches)
+	{
+		TArray< FName > UnloadBundles;
+		UnloadBundles.Reserve( Batch.Key.Num( ) );
+		for (const int BundleIndex : Batch.Key)
+			UnloadBundles.Push( BundleNameTable[ BundleIndex ] );
+
+		TSharedPtr< FStreamableHandle > UnloadHandle = Super::ChangeBundleStateForPrimaryAssets( Batch.Value, { }, UnloadBundles, false );
+		if (UnloadHandle.IsValid( ) && UnloadHandle->IsActive( ))
+			AllHandles.Push( UnloadHandle );
 	}
 
 	// Create a single streaming handle for the combined unloads
@@ -352,8 +502,11 @@ TSharedPtr< FStreamableHandle > UDataDefinitionLibrary::DecrementRefCountsAndUnl
 			CombinedBundleNames << TEXT(" ");
 		}
 		CombinedBundleNames << TEXT(")");
+
+		const bool bSingleSource = Algo::AllOf( Changes, [ &Changes ]( const FBundleRefChange &C ) -> bool { return C.SourceID == Changes[ 0 ].SourceID; } );
+		const FString SourceName = bSingleSource ? Changes[ 0 ].SourceID.ToString( ) : GetName( );
 		
-		return StreamableManager.CreateCombinedHandle( AllHandles, FString::Printf( TEXT( "%s DecrementingRefs for bundles %s" ), *SourceID.ToString(), *CombinedBundleNames ) );
+		return StreamableManager.CreateCombinedHandle( AllHandles, FString::Printf( TEXT( "%s DecrementingRefs for bundles %s" ), *SourceName, *CombinedBundleNames ) );
 	}
 
 	return { };
@@ -388,14 +541,17 @@ TSharedPtr< FStreamableHandle > UDataDefinitionLibrary::ChangeBundleStateForPrim
 	if (LoadHandle.IsValid( ) && LoadHandle->IsActive( ))
 		AllHandles.Push( LoadHandle );
 
+	// Each asset is the source of its own references
+	TArray< FBundleRefChange > Changes;
+	Changes.Reserve( AssetsToChange.Num( ) );
 	for (const FPrimaryAssetId &ID : AssetsToChange)
-	{
-		IncrementRefCounts( { ID }, AddBundles, ID );
+		Changes.Add( { ID, ID } );
 
-		TSharedPtr< FStreamableHandle > UnloadHandle = DecrementRefCountsAndUnload( { ID }, RemoveBundles, ID );
-		if (UnloadHandle.IsValid( ) && UnloadHandle->IsActive( ))
-			AllHandles.Push( UnloadHandle );
-	}
+	IncrementRefCounts( Changes, AddBundles );
+
+	TSharedPtr< FStreamableHandle > UnloadHandle = DecrementRefCountsAndUnload( Changes, RemoveBundles );
+	if (UnloadHandle.IsValid( ) && UnloadHandle->IsActive( ))
+		AllHandles.Push( UnloadHandle );
 
 	// Create a single streaming handle for the combined loads and unloads
 	if (!AllHandles.IsEmpty())
@@ -421,6 +577,7 @@ TSharedPtr< FStreamableHandle > UDataDefinitionLibrary::ChangeBundleStateForPrim
 		// We don't really care about the ref counts to actually make the load request since they're not ref-counted anyway at the engine level. Already loaded things aren't loaded again already
 		// So build up a big list of all the dependencies that need bundle changes and just update the ref counts
 		TSet< FPrimaryAssetId > Dependencies;
+		TArray< FBundleRefChange > Changes;
 		for (const auto &ID : AssetsToChange)
 		{
 			TSet< FPrimaryAssetId > AssetDependencies;
@@ -428,9 +585,12 @@ TSharedPtr< FStreamableHandle > UDataDefinitionLibrary::ChangeBundleStateForPrim
 			GetPrimaryAssetDependencies( ID, AssetDependencies, AddBundles );
 			Dependencies.Append( AssetDependencies );
 
-			IncrementRefCounts( AssetDependencies, AddBundles, ID );
+			for (const auto &Dependency : AssetDependencies)
+				Changes.Add( { Dependency, ID } );
 		}
 
+		IncrementRefCounts( Changes, AddBundles );
+
 		TArray< FPrimaryAssetId > NewAssetsToChange = Dependencies.Array( );
 
 		if (bFilterMaps)
@@ -444,7 +604,8 @@ TSharedPtr< FStreamableHandle > UDataDefinitionLibrary::ChangeBundleStateForPrim
 	// Repeat the process for RemoveBundles so that we don't load AddBundle dependencies for things that we should only be unloading
 	{
 		// For unloads, we have to be more precise since we could be unloading bundles A/B for Assets x/y/z and only need to unload A for x, B for y and nothing for z
-		// so we make the unload requests for each asset's individual dependencies and that makes the appropriate unload requests for each dependency.
+		// so we gather each asset's individual dependencies and the ref-counting determines the appropriate unload requests for each dependency.
+		TArray< FBundleRefChange > Changes;
 		for (const auto &ID : AssetsToChange)
 		{
 			TSet< FPrimaryAssetId > AssetDependencies;
@@ -460,10 +621,13 @@ TSharedPtr< FStreamableHandle > UDataDefinitionLibrary::ChangeBundleStateForPrim
 				}
 			}
 
-			TSharedPtr< FStreamableHandle > UnloadHandle = DecrementRefCountsAndUnload( AssetDependencies, RemoveBundles, ID );
-			if (UnloadHandle.IsValid( ) && UnloadHandle->IsActive( ))
-				StreamHandles.Push( UnloadHandle );
+			for (const auto &Dependency : AssetDependencies)
+				Changes.Add( { Dependency, ID } );
 		}
+
+		TSharedPtr< FStreamableHandle > UnloadHandle = DecrementRefCountsAndUnload( Changes, RemoveBundles );
+		if (UnloadHandle.IsValid( ) && UnloadHandle->IsActive( ))
+			StreamHandles.Push( UnloadHandle );
 	}
 
 	// Create a single streaming handle for the combined loads and unloads
@@ -524,6 +688,7 @@ void UDataDefinitionLibrary::AddReferencedObjects( UObject *InThis, FReferenceCo
 			Collector.AddReferencedObjects( Entry.Value, InThis );
 
 		Collector.AddReferencedObjects( Library->ActiveDefinitions, InThis );
+		Collector.AddReferencedObjects( Library->DefinitionIDIndex, InThis );
 		Collector.AddReferencedObjects( Library->ActiveExtensions, InThis );
 	}
 
@@ -535,6 +700,7 @@ void UDataDefinitionLibrary::PostInitialAssetScan( )
 	Super::PostInitialAssetScan( );
 
 	DetermineNonFeatureAssets( );
+	InvalidateDependencyCache( );
 }
 
 // Implementation duplicated from GameFeaturesSubsystem::IsContentActiveWithinActivePlugin
@@ -563,6 +729,9 @@ void UDataDefinitionLibrary::RemovePrimaryAssetId( const FPrimaryAssetId &Primar
 
 	NonFeatureAssets.Remove( PrimaryAssetId );
 
+	// Other assets may have cached references to this one, so the whole cache is stale
+	InvalidateDependencyCache( );
+
 	Super::RemovePrimaryAssetId( PrimaryAssetId );
 }
 
@@ -577,6 +746,17 @@ void UDataDefinitionLibrary::OnObjectPreSave( UObject *Object, FObjectPreSaveCon
 			NonFeatureAssets.Push( Object->GetPrimaryAssetId( ) );
 	}
 
+	const auto PrimaryAssetId = Object->GetPrimaryAssetId( );
+	if (PrimaryAssetId.IsValid( ))
+	{
+		// Saving may change the bundle data for an existing asset, which only affects that asset's references.
+		// A new primary asset could be referenced by anything that was cached before it existed.
+		if (GetPrimaryAssetPath( PrimaryAssetId ).IsNull( ))
+			InvalidateDependencyCache( );
+		else
+			InvalidateDependencyCache( PrimaryAssetId );
+	}
+
 	Super::OnObjectPreSave( Object, SaveContext );
 }
 #endif
@@ -728,6 +908,8 @@ void UDataDefinitionLibrary::GameInstanceShutdown( const UGameInstance *Game )
 	ActiveDefinitions.Empty( );
 	ActiveExtensions.Empty( );
 	LibraryTypeMap.Empty( );
+	DefinitionIDIndex.Empty( );
+	DefinitionNameIndex.Empty( );
 	PrimaryAssetBundleCounts.Empty( );
 
 	Super::ChangeBundleStateForPrimaryAssets( PrimaryAssetIDs, { }, { }, true );
@@ -752,7 +934,7 @@ void UDataDefinitionLibrary::GetDefinitions_BP( TSubclassOf< UDataDefinition > T
 FDataDefinitionIterator::FDataDefinitionIterator( const UClass *SearchType )
 {
 	const auto Library = UDataDefinitionLibrary::GetInstance( );
-	Library->GetAllDefinitionsForType( SearchType, Definitions );
+	Definitions = Library->GetDefinitionsViewForType( SearchType );
 
 	++(*this);
 }
@@ -39,6 +39,15 @@ template < CInterfaceType type_t >
 	return ReturnArray;
 }
 
+template < CDefinitionType type_t >
+TConstArrayView< const type_t* > UDataDefinitionLibrary::GetDefinitionsView( void ) const
+{
+	const auto View = GetDefinitionsViewForType( GetStaticClass< type_t >( ) );
+
+	// Every definition in a type's bucket is of that type, so the pointers can be reinterpreted directly
+	return TConstArrayView< const type_t* >( reinterpret_cast< const type_t* const* >( View.GetData( ) ), View.Num( ) );
+}
+
 template < CDefinitionType type_t >
 TArray< FPrimaryAssetId > UDataDefinitionLibrary::GetAllDefinitionIDs( void ) const
 {
@@ -55,6 +64,12 @@ const type_t* UDataDefinitionLibrary::DEBUG_FindDefinition( const FName &AssetNa
 	return Cast< type_t >( FindDefinition( type_t::StaticClass( ), AssetName ) );
 }
 
+template < CDefinitionType type_t >
+const type_t* UDataDefinitionLibrary::FindActiveDefinition( const FPrimaryAssetId &AssetID ) const
+{
+	return Cast< type_t >( FindDefinition( AssetID ) );
+}
+
 template < CDefinitionType type_t >
 TDataDefinitionIterator< type_t >::TDataDefinitionIterator( ): FDataDefinitionIterator( GetStaticClass< type_t >( ) )
 {
@@ -81,12 +81,17 @@ void UDefinitionLibrary_GameFeatureWatcher::OnGameFeatureRegistering( const UGam
 	PluginNames.Add( GameFeatureData, PluginName );
 
 	UpdateFeatureCache( GameFeatureData );
+
+	// References to the feature's primary assets can now be resolved
+	UDataDefinitionLibrary::GetInstance( )->InvalidateDependencyCache( );
 }
 
 void UDefinitionLibrary_GameFeatureWatcher::OnGameFeatureUnregistering( const UGameFeatureData *GameFeatureData, const FString &PluginName, const FString &PluginURL )
 {
 	PluginNames.Remove( GameFeatureData );
 	FeatureAssets.Remove( GameFeatureData );
+
+	UDataDefinitionLibrary::GetInstance( )->InvalidateDependencyCache( );
 }
 
 void UDefinitionLibrary_GameFeatureWatcher::OnGameFeatureActivating( const UGameFeatureData *GameFeatureData, const FString& PluginURL )
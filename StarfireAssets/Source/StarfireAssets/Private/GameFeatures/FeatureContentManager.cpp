@@ -65,12 +65,20 @@ void UFeatureContentManager::OnGameFeatureRegistering( const UGameFeatureData *G
 	if (!ensureAlways( FeatureContent != nullptr ))
 		return;
 	
-	KnownFeatureData.Add( FeatureContent );
+	const int FeatureIndex = KnownFeatureData.Add( FeatureContent );
+	AddFeatureToTagIndex( FeatureIndex );
 
 	DataMapping.Add( PluginName, FeatureContent );
 	NameMapping.Add( FeatureContent, PluginName );
 	URLMapping.Add( FeatureContent, PluginURL );
 
+	// Plugin content is mounted at the plugin name unless the plugin specifies otherwise
+	FString MountPoint = PluginName;
+	if (const auto Plugin = IPluginManager::Get( ).FindPlugin( PluginName ))
+		MountPoint = Plugin->GetMountedAssetPath( ).TrimChar( TEXT( '/' ) );
+
+	MountPointMapping.Add( FName( MountPoint ), FeatureContent );
+
 	if (FeatureContent->ContentFlags.HasTag( UStarfireFeatureData::ContentFlag_BuiltIn ))
 	{
 #if UE_BUILD_SHIPPING
@@ -102,6 +110,7 @@ void UFeatureContentManager::OnGameFeatureUnregistering( const UGameFeatureData
 	
 	// If a feature becomes unregistered during gameplay we should clean it up as if it never existed
 	KnownFeatureData.Remove( FeatureContent );
+	RebuildFeatureTagIndex( );
 
 	OwnedFeatures.Remove( FeatureContent );
 	EnabledFeatures.Remove( FeatureContent );
@@ -110,10 +119,43 @@ void UFeatureContentManager::OnGameFeatureUnregistering( const UGameFeatureData
 	NameMapping.Remove( FeatureContent );
 	URLMapping.Remove( FeatureContent );
 
+	for (auto It = MountPointMapping.CreateIterator( ); It; ++It)
+	{
+		if (It->Value == FeatureContent)
+			It.RemoveCurrent( );
+	}
+
 	auto &AssetManager = UAssetManager::Get( );
 	AssetManager.ChangeBundleStateForPrimaryAssets( { GameFeatureData->GetPrimaryAssetId( ) }, { }, { }, /*bRemoveAllBundles*/ true );
 }
 
+void UFeatureContentManager::AddFeatureToTagIndex( int FeatureIndex )
+{
+	const auto &Feature = KnownFeatureData[ FeatureIndex ];
+
+	// Index under all the parent tags as well so that lookups match the same way that HasTag & MatchesTag do
+	auto AllTags = Feature->ContentFlags.GetGameplayTagParents( );
+	if (Feature->ContentType.IsValid( ))
+		AllTags.AppendTags( Feature->ContentType.GetGameplayTagParents( ) );
+
+	for (const auto &Tag : AllTags)
+	{
+		auto &Features = FeatureTagIndex.FindOrAdd( Tag );
+		if (Features.Num( ) <= FeatureIndex)
+			Features.SetNum( FeatureIndex + 1, false );
+
+		Features[ FeatureIndex ] = true;
+	}
+}
+
+void UFeatureContentManager::RebuildFeatureTagIndex( void )
+{
+	FeatureTagIndex.Empty( );
+
+	for (int x = 0; x < KnownFeatureData.Num( ); ++x)
+		AddFeatureToTagIndex( x );
+}
+
 const UStarfireFeatureData* UFeatureContentManager::FindFeature( const FString &PluginName ) const
 {
 	if (const auto Find = DataMapping.Find( PluginName ))
@@ -226,23 +268,81 @@ TArray< const UStarfireFeatureData* > UFeatureContentManager::GetKnownFeatures(
 {
 	TArray< const UStarfireFeatureData* > Results;
 
-	for (const auto &F : KnownFeatureData)
-	{
-		if (F->ContentFlags.HasTag( RequiredTag ))
-			Results.Push( F );
-		else if (F->ContentType.MatchesTag( RequiredTag ))
-			Results.Push( F );
-	}
+	const auto Features = FeatureTagIndex.Find( RequiredTag );
+	if (Features == nullptr)
+		return Results;
+
+	for (TConstSetBitIterator< > It( *Features ); It; ++It)
+		Results.Push( KnownFeatureData[ It.GetIndex( ) ] );
 
 	return Results;
 }
 
+// Determine the features that could possibly match a query expression based on the tags the expression references
+// This is always a superset of the features that match, so the results still need to be checked against the full query
+[[nodiscard]] static TBitArray< > GetQueryCandidates( const FGameplayTagQueryExpression &Expr, const TMap< FGameplayTag, TBitArray< > > &TagIndex, int NumFeatures )
+{
+	switch (Expr.ExprType)
+	{
+		case EGameplayTagQueryExprType::AnyTagsMatch:
+		{
+			TBitArray< > Candidates( false, NumFeatures );
+			for (const auto &Tag : Expr.TagSet)
+			{
+				if (const auto Features = TagIndex.Find( Tag ))
+					Candidates.CombineWithBitwiseOR( *Features, EBitwiseOperatorFlags::MaxSize );
+			}
+			return Candidates;
+		}
+
+		case EGameplayTagQueryExprType::AllTagsMatch:
+		{
+			TBitArray< > Candidates( true, NumFeatures );
+			for (const auto &Tag : Expr.TagSet)
+			{
+				const auto Features = TagIndex.Find( Tag );
+				if (Features == nullptr)
+					return TBitArray< >( false, NumFeatures );
+
+				Candidates.CombineWithBitwiseAND( *Features, EBitwiseOperatorFlags::MaxSize );
+			}
+			return Candidates;
+		}
+
+		case EGameplayTagQueryExprType::AnyExprMatch:
+		{
+			TBitArray< > Candidates( false, NumFeatures );
+			for (const auto &SubExpr : Expr.ExprSet)
+				Candidates.CombineWithBitwiseOR( GetQueryCandidates( SubExpr, TagIndex, NumFeatures ), EBitwiseOperatorFlags::MaxSize );
+			return Candidates;
+		}
+
+		case EGameplayTagQueryExprType::AllExprMatch:
+		{
+			TBitArray< > Candidates( true, NumFeatures );
+			for (const auto &SubExpr : Expr.ExprSet)
+				Candidates.CombineWithBitwiseAND( GetQueryCandidates( SubExpr, TagIndex, NumFeatures ), EBitwiseOperatorFlags::MaxSize );
+			return Candidates;
+		}
+
+		default:
+			// Negations (and anything else) can match features without any of the referenced tags, so they can't narrow the search
+			return TBitArray< >( true, NumFeatures );
+	}
+}
+
 TArray< const UStarfireFeatureData* > UFeatureContentManager::GetKnownFeatures( const FGameplayTagQuery &Query ) const
 {
 	TArray< const UStarfireFeatureData* > Results;
 
-	for (const auto &F : KnownFeatureData)
+	FGameplayTagQueryExpression Expression;
+	Query.GetQueryExpr( Expression );
+
+	const auto Candidates = GetQueryCandidates( Expression, FeatureTagIndex, KnownFeatureData.Num( ) );
+
+	for (TConstSetBitIterator< > It( Candidates ); It; ++It)
 	{
+		const auto &F = KnownFeatureData[ It.GetIndex( ) ];
 		if (Query.Matches( F->ContentFlags ))
 			Results.Push( F );
 	}
@@ -516,12 +616,33 @@ const UStarfireFeatureData* UFeatureContentManager::GetObjectFeaturePlugin( cons
 	return GetObjectFeaturePlugin( Content.ToSoftObjectPath( ) );
 }
 
+// Get the mount point of a path, the first element of the package name (ie "/MountPoint/Path/To/Package")
+[[nodiscard]] static FName GetPathMountPoint( const FSoftObjectPath &ContentPath )
+{
+	TStringBuilder< 256 > PackageName;
+	ContentPath.GetLongPackageFName( ).AppendString( PackageName );
+
+	FStringView Root = PackageName.ToView( );
+	if (!Root.StartsWith( TEXT( '/' ) ))
+		return NAME_None;
+
+	Root.RightChopInline( 1 );
+
+	int32 RootEnd = INDEX_NONE;
+	if (Root.FindChar( TEXT( '/' ), RootEnd ))
+		Root.LeftInline( RootEnd );
+
+	// Only find, any mount point that isn't already a name can't be in the mapping
+	return FName( Root.Len( ), Root.GetData( ), FNAME_Find );
+}
+
 const UStarfireFeatureData* UFeatureContentManager::GetObjectFeaturePlugin( const FSoftObjectPath &ContentPath ) const
 {
-	const auto &FeatureSubsystem = UGameFeaturesSubsystem::Get( );
-	const auto PluginName = FeatureSubsystem.FindPluginContainingAsset( ContentPath );
+	const auto MountPoint = GetPathMountPoint( ContentPath );
+	if (MountPoint.IsNone( ))
+		return nullptr;
 
-	const auto FoundPlugin = DataMapping.Find( PluginName );
+	const auto FoundPlugin = MountPointMapping.Find( MountPoint );
 	if (FoundPlugin == nullptr)
 		return nullptr;
 
@@ -31,6 +31,11 @@ public:
 	template < CInterfaceType type_t >
 	[[nodiscard]] TArray< const type_t* > GetAllDefinitions( void ) const;
 
+	// Get a non-allocating view of all the definitions that are of a particular type
+	// The view references the library's internal storage and is invalidated when definitions are added or removed (ie, feature activation)
+	template < CDefinitionType type_t >
+	[[nodiscard]] TConstArrayView< const type_t* > GetDefinitionsView( void ) const;
+
 	// Get all the asset ids for the definitions of a particular type
 	template < CDefinitionType type_t >
 	[[nodiscard]] TArray< FPrimaryAssetId > GetAllDefinitionIDs( void ) const;
@@ -39,6 +44,10 @@ public:
 	template < CDefinitionType type_t >
 	[[nodiscard]] const type_t* DEBUG_FindDefinition( const FName &AssetName );
 
+	// Find an active definition of the right type based on asset ID (null if the definition isn't loaded & active)
+	template < CDefinitionType type_t >
+	[[nodiscard]] const type_t* FindActiveDefinition( const FPrimaryAssetId &AssetID ) const;
+
 	// Do some custom game instance startup, such as loading non-feature and active feature definitions and toggling the preload bundles
 	TSharedPtr< FStreamableHandle > GameInstanceInit( const UGameInstance *Game );
 	// Do some custom game instance cleanup, such as unloading the definitions
@@ -83,10 +92,14 @@ protected:
 private:
 	// Internal utility for getting all the definitions of a particular type
 	void GetAllDefinitionsForType( const UClass *ClassType, TArray< const UDataDefinition* > &outArray ) const;
+	// Internal utility for getting a view of the definitions of a particular type without copying them
+	[[nodiscard]] TConstArrayView< const UDataDefinition* > GetDefinitionsViewForType( const UClass *ClassType ) const;
 	// Internal utility for getting all the asset ids for the definitions of a particular type
 	void GetAllDefinitionIDsForType( const UClass *ClassType, TArray< FPrimaryAssetId > &outArray ) const;
 	// Internal utility for finding an asset of a specific name and proper sub-typing
 	[[nodiscard]] const UDataDefinition* FindDefinition( const UClass *ClassType, const FName &AssetName ) const;
+	// Internal utility for finding an active asset with a specific asset id
+	[[nodiscard]] const UDataDefinition* FindDefinition( const FPrimaryAssetId &AssetID ) const;
 
 	// All the definitions loaded by the project, broken down into buckets by type
 	typedef TArray< TObjectPtr< const UDataDefinition > > DefinitionSet;
@@ -95,6 +108,11 @@ private:
 	// A hashed lookup for all the definitions that are part of currently active plugins
 	TSet< TObjectPtr< const UDataDefinition > > ActiveDefinitions;
 
+	// Hashed indices of the active definitions for lookups by asset id or by asset name
+	// Asset names are only unique within a primary asset type, so a name may map to multiple asset ids
+	TMap< FPrimaryAssetId, TObjectPtr< const UDataDefinition > > DefinitionIDIndex;
+	TMultiMap< FName, FPrimaryAssetId > DefinitionNameIndex;
+
 	// Collections of extensions that may have tried to be applied but the definition wasn't loaded yet
 	// This could happen due to out-of-order feature activation (ie, not based on feature dependencies)
 	// or a feature could be extending an asset in an optional feature that hasn't been activated
@@ -122,6 +140,17 @@ private:
 	// Determine the set of definitions which do not reside within a game feature plugin
 	void DetermineNonFeatureAssets( void );
 
+	// Cached primary asset references for each asset & bundle pair, the edges of the graph walked by GetPrimaryAssetDependencies
+	// Extension dependencies aren't cached as they change with feature activation and can be read from the definition directly
+	typedef TMap< FName, TArray< FPrimaryAssetId > > FBundleDependencies;
+	mutable TMap< FPrimaryAssetId, FBundleDependencies > DependencyCache;
+
+	// Get the primary assets that are directly referenced by an asset through a specific bundle (building the cache entry if needed)
+	const TArray< FPrimaryAssetId >& GetBundleDependencies( const FPrimaryAssetId &AssetID, const FName &BundleName ) const;
+	// Clear the cached dependencies for a single asset (or for all assets) after the asset data has changed
+	void InvalidateDependencyCache( const FPrimaryAssetId &AssetID );
+	void InvalidateDependencyCache( void );
+
 	friend struct FDataDefinitionIterator;
 	friend class UDefinitionLibrary_GameFeatureWatcher;
 
@@ -129,27 +158,49 @@ private:
 	UFUNCTION( BlueprintCallable, Category = "Definition Library", meta = (DisplayName = "Get Definitions for Type", DeterminesOutputType = "Type", DynamicOutputParam = "Definitions"))
 	static void GetDefinitions_BP( TSubclassOf< UDataDefinition > Type, /*UPARAM( NoDiscard )*/ TArray< UDataDefinition* > &Definitions );
 
-	// The ref-count information for a single primary data asset
-	struct FBundleCounts
+	// The ref-count information for a single bundle of a primary data asset
+	struct FBundleCount
 	{
-		// The overall ref-count for the asset. This should always be the sum of the SourceRefs map below
+		// Index of the bundle name in the BundleNameTable
+		int BundleIndex = INDEX_NONE;
+
+		// The overall ref-count for the bundle. This should always be the sum of the RefSources counts below
 		int RefCount = 0;
 
 		// Individual ref-counts for each source that requested the asset (mostly for debugging & back tracking)
-		TMap< FPrimaryAssetId, int > RefSources;
+		TArray< TPair< FPrimaryAssetId, int >, TInlineAllocator< 1 > > RefSources;
 	};
+	// The ref-counts for all the bundles with references for a single primary data asset, there are rarely more than a couple
+	typedef TArray< FBundleCount, TInlineAllocator< 2 > > FBundleData;
 	// The full collection of ref-counts for all primary assets that have had bundles loaded for them
-	typedef TMap< FName, FBundleCounts > FBundleData;
-	TMap< FPrimaryAssetId, FBundleData  > PrimaryAssetBundleCounts;
+	TMap< FPrimaryAssetId, FBundleData > PrimaryAssetBundleCounts;
+
+	// Interned bundle names so that the per-asset counts can be found by index instead of hashing names
+	TArray< FName > BundleNameTable;
+	TMap< FName, int > BundleNameIndices;
+
+	// Get the index of a bundle name in the BundleNameTable, adding it if it's a new bundle name
+	int InternBundleName( const FName &BundleName );
+
+	// A single asset whose bundle ref-counts should be changed on behalf of a source asset
+	struct FBundleRefChange
+	{
+		FPrimaryAssetId AssetID;
+		FPrimaryAssetId SourceID;
+	};
 
 	// Utility for updating the BundleCounts map
 	void IncrementRefCounts( const TSet< FPrimaryAssetId > &Assets, const TArray< FName > &BundleNames, const FPrimaryAssetId &SourceID );
+	void IncrementRefCounts( TConstArrayView< FBundleRefChange > Changes, const TArray< FName > &BundleNames );
 	// Utility for updating the BundleCounts map and making the bundle change calls to unload assets
 	// This is because the bundles that need to be unloaded for each asset could be a subset of BundleNames that is different for each asset
+	// Assets that need the same bundles unloaded are batched into a single bundle change call
 	TSharedPtr< FStreamableHandle > DecrementRefCountsAndUnload( const TSet< FPrimaryAssetId > &Assets, const TArray< FName > &BundleNames, const FPrimaryAssetId &SourceID );
+	TSharedPtr< FStreamableHandle > DecrementRefCountsAndUnload( TConstArrayView< FBundleRefChange > Changes, const TArray< FName > &BundleNames );
 };
 
 // Iterator over sets of data definitions
+// Iterates the library's storage in place, so definitions shouldn't be added or removed from the library during iteration
 struct STARFIREASSETS_API FDataDefinitionIterator
 {
 public:
@@ -180,7 +231,7 @@ private:
 	int Index = 0;
 
 	// The actual data set to iterate
-	TArray< const UDataDefinition* > Definitions;
+	TConstArrayView< const UDataDefinition* > Definitions;
 };
 
 // Templated version of data definition iteration
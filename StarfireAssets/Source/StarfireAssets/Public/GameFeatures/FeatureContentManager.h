@@ -5,11 +5,10 @@
 #include "GameFeatureStateChangeObserver.h"
 #include "Engine/DeveloperSettings.h"
 #include "Templates/SubsystemNativeAccessors.h"
+#include "GameplayTagContainer.h"
 
 #include "FeatureContentManager.generated.h"
 
-struct FGameplayTag;
-struct FGameplayTagQuery;
 class UStarfireFeatureData;
 class UGameFeaturesSubsystem;
 
@@ -166,6 +165,20 @@ private:
 	UPROPERTY( )
 	TMap< TObjectPtr< const UStarfireFeatureData >, FString > URLMapping;
 
+	// Mapping of the content mount point (ie "/PluginName/" without the slashes) to the feature data
+	// Used to resolve object paths to features without searching through all the features for one containing the path
+	UPROPERTY( )
+	TMap< FName, TObjectPtr< const UStarfireFeatureData > > MountPointMapping;
+
+	// Mapping of gameplay tags to the features with that tag (or a child of it) as a content flag or content type
+	// Bits correspond to indices in KnownFeatureData so that lookups preserve the KnownFeatureData order
+	TMap< FGameplayTag, TBitArray< > > FeatureTagIndex;
+
+	// Add the tags of a feature at a specific index of KnownFeatureData to the tag index
+	void AddFeatureToTagIndex( int FeatureIndex );
+	// Recreate the tag index from scratch after the KnownFeatureData indices have changed
+	void RebuildFeatureTagIndex( void );
+
 	DECLARE_FUNCTION( execGetOwnedFeatures );
 	DECLARE_FUNCTION( execGetEnabledFeatures );
 
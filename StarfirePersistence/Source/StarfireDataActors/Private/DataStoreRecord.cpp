@@ -0,0 +1,22 @@
+#include "DataStoreRecord.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(DataStoreRecord)
+
+void UDataStoreRecord::Serialize( FArchive &Ar )
+{
+	// Same as Data Store Actors, all of the record's data makes up the model of the game's data so the SaveGame markup is ignored
+	const bool bWasSaveGame = Ar.IsSaveGame( );
+	Ar.ArIsSaveGame = false;
+
+	Super::Serialize( Ar );
+
+	Ar.ArIsSaveGame = bWasSaveGame;
+}
+
+UWorld* UDataStoreRecord::GetWorld( ) const
+{
+	if (HasAnyFlags( RF_ClassDefaultObject ))
+		return nullptr;
+
+	return GetOuter( )->GetWorld( );
+}
@@ -21,6 +21,18 @@ void ADataStoreSingleton::Destroyed( )
 	Super::Destroyed( );
 }
 
+void ADataStoreSingleton::EndPlay( const EEndPlayReason::Type EndPlayReason )
+{
+	// Streamed out levels don't destroy their actors, so stop handing this one out before it's garbage collected
+	if (EndPlayReason == EEndPlayReason::RemovedFromWorld)
+	{
+		if (const auto Subsystem = UPersistentDataStore::GetSubsystem( this ))
+			Subsystem->RemoveSingleton( this );
+	}
+
+	Super::EndPlay( EndPlayReason );
+}
+
 #if WITH_EDITOR
 FString ADataStoreSingleton::GetCustomActorLabel_Implementation( ) const
 {
@@ -2,6 +2,7 @@
 #include "PersistentDataStore.h"
 
 #include "DataStoreActor.h"
+#include "DataStoreRecord.h"
 #include "DataStoreSettings.h"
 #include "DataStoreSingleton.h"
 #include "Module/StarfireDataActors.h"
@@ -13,6 +14,9 @@
 
 TSharedPtr< FStreamableHandle > UPersistentDataStore::OverrideTypesLoading;
 TMap< TSubclassOf< ADataStoreActor >, TSubclassOf< ADataStoreActor > > UPersistentDataStore::ClassOverrides;
+bool UPersistentDataStore::bClassOverridesApplied = false;
+TArray< TFunction< void( ) > > UPersistentDataStore::PendingOverrideRequests;
+int32 UPersistentDataStore::NumInitializedStores = 0;
 
 [[nodiscard]] static UClass* GetFirstNativeParent( UClass* Type )
 {
@@ -35,39 +39,116 @@ void UPersistentDataStore::Initialize( FSubsystemCollectionBase &Collection )
 
 	Settings = GetDefault< UDataStoreSettings >( );
 
-	if (!Settings->BlueprintOverrides.IsEmpty( ) && !OverrideTypesLoading.IsValid( ))
-	{
-		TArray< FSoftObjectPath > TypePaths;
-		Algo::Transform( Settings->BlueprintOverrides, TypePaths,
-			[ ]( const TSoftClassPtr< ADataStoreActor > &Type ) -> FSoftObjectPath { return Type.ToSoftObjectPath( ); } );
-		TypePaths.RemoveAll( [ ]( const FSoftObjectPath& Path ) -> bool { return Path.IsNull( ); } );
+	if (!AreOverridesResolved( ) && !OverrideTypesLoading.IsValid( ))
+		LoadClassOverrides( );
+
+	++NumInitializedStores;
+
+	RegisterPersistentSubsystem( this );
+}
+
+void UPersistentDataStore::Deinitialize( )
+{
+	UnregisterPersistentSubsystem( this );
+
+	bDeinitializing = true;
 
-		const auto OnLoadComplete = [ WeakThis = TWeakObjectPtr(this) ]( ) -> void
+	// Nothing is left to wait on the override types, so don't leave requests waiting on a load that may never complete
+	--NumInitializedStores;
+	if ((NumInitializedStores == 0) && !AreOverridesResolved( ))
+		CancelClassOverrides( );
+
+	Super::Deinitialize( );
+}
+
+void UPersistentDataStore::LoadClassOverrides( void )
+{
+	TArray< FSoftObjectPath > TypePaths;
+	Algo::Transform( GetDefault< UDataStoreSettings >( )->BlueprintOverrides, TypePaths,
+		[ ]( const TSoftClassPtr< ADataStoreActor > &Type ) -> FSoftObjectPath { return Type.ToSoftObjectPath( ); } );
+	TypePaths.RemoveAll( [ ]( const FSoftObjectPath& Path ) -> bool { return Path.IsNull( ); } );
+
+	if (!TypePaths.IsEmpty( ))
+	{
+		// Not bound to this subsystem since the overrides are shared by every world and requests from other worlds may be waiting on them
+		const auto OnLoadComplete = [ ]( ) -> void
 		{
-			static const auto DataActorClass = ADataStoreActor::StaticClass( );
-			static const auto SingletonActorClass = ADataStoreSingleton::StaticClass( );
-		
-			if (!WeakThis.IsValid( ))
-				return;
-		
-			for (const auto &Type : WeakThis->Settings->BlueprintOverrides)
-			{
-				if (!ensureAlwaysMsgf( !Type->IsNative( ), TEXT( "Native type '%s' found in Data Store Settings - Blueprint Overrides." ), *Type->GetName( ) ))
-					continue;
-
-				const auto NativeParent = GetFirstNativeParent( Type.Get( ) );
-				if (NativeParent == DataActorClass)
-					continue;
-				if (NativeParent == SingletonActorClass)
-					continue;
-
-				ensureAlwaysMsgf( ClassOverrides.Find( NativeParent ) == nullptr, TEXT( "Multiple Data Store Actor overrides found for class '%s'." ), *NativeParent->GetName( ) );
-				ClassOverrides.Add( NativeParent, Type.Get( ) );
-			}
+			ApplyClassOverrides( );
 		};
 
 		OverrideTypesLoading = UAssetManager::Get( ).GetStreamableManager( ).RequestAsyncLoad( TypePaths, OnLoadComplete );
 	}
+
+	if (OverrideTypesLoading.IsValid( ))
+		OverrideTypesLoading->BindCancelDelegate( FStreamableDelegate::CreateStatic( &UPersistentDataStore::CancelClassOverrides ) );
+	else
+		ApplyClassOverrides( ); // nothing to wait on
+}
+
+void UPersistentDataStore::ApplyClassOverrides( void )
+{
+	static const auto DataActorClass = ADataStoreActor::StaticClass( );
+	static const auto SingletonActorClass = ADataStoreSingleton::StaticClass( );
+
+	if (bClassOverridesApplied)
+		return;
+
+	for (const auto &Type : GetDefault< UDataStoreSettings >( )->BlueprintOverrides)
+	{
+		if (!Type.IsValid( ))
+			continue; // either not set or failed to load
+
+		if (!ensureAlwaysMsgf( !Type->IsNative( ), TEXT( "Native type '%s' found in Data Store Settings - Blueprint Overrides." ), *Type->GetName( ) ))
+			continue;
+
+		const auto NativeParent = GetFirstNativeParent( Type.Get( ) );
+		if (NativeParent == DataActorClass)
+			continue;
+		if (NativeParent == SingletonActorClass)
+			continue;
+
+		ensureAlwaysMsgf( ClassOverrides.Find( NativeParent ) == nullptr, TEXT( "Multiple Data Store Actor overrides found for class '%s'." ), *NativeParent->GetName( ) );
+		ClassOverrides.Add( NativeParent, Type.Get( ) );
+	}
+
+	bClassOverridesApplied = true;
+
+	// Move out first in case a request leads to another request being made
+	const auto Pending = MoveTemp( PendingOverrideRequests );
+	for (const auto &Request : Pending)
+		Request( );
+}
+
+void UPersistentDataStore::CancelClassOverrides( void )
+{
+	if (!OverrideTypesLoading.IsValid( ) || bClassOverridesApplied)
+		return;
+
+	// Cleared first so that the cancel delegate doesn't re-enter
+	const auto Handle = MoveTemp( OverrideTypesLoading );
+
+	if (NumInitializedStores > 0)
+	{
+		// Cancelled out from under data stores that still need the overrides, resolving them now would leave those worlds
+		// spawning (and saving) the native types instead, so start again and leave the requests waiting on the new load
+		UE_LOG( LogStarfireDataActors, Warning, TEXT( "Data Store override types loading was cancelled, restarting the load." ) );
+		LoadClassOverrides( );
+		return;
+	}
+
+	// Run any waiting requests with whatever types did load, they can only be from data stores that are going away
+	ApplyClassOverrides( );
+
+	// Forget the partial results so that the next data store starts the load again
+	ClassOverrides.Empty( );
+	bClassOverridesApplied = false;
+
+	Handle->CancelHandle( );
+}
+
+bool UPersistentDataStore::AreOverridesResolved( void )
+{
+	return bClassOverridesApplied;
 }
 
 bool UPersistentDataStore::DoesSupportWorldType( const EWorldType::Type WorldType ) const
@@ -143,14 +224,8 @@ ADataStoreSingleton* UPersistentDataStore::SpawnSingleton( TSubclassOf< ADataSto
 	if (!ensureAlways( SingletonType != nullptr ))
 		return nullptr;
 
-	if (OverrideTypesLoading.IsValid( ) && !OverrideTypesLoading->HasLoadCompleted( ))
-		OverrideTypesLoading->WaitUntilComplete( );
-
 	if (SingletonType->IsNative( ))
-	{
-		if (const auto Found = ClassOverrides.Find( SingletonType ))
-			SingletonType = *Found;
-	}
+		SingletonType = GetOverrideClassFor( SingletonType ).Get( );
 
 	FActorSpawnParameters Params;
 	Params.bDeferConstruction = true;
@@ -164,6 +239,23 @@ ADataStoreSingleton* UPersistentDataStore::SpawnSingleton( TSubclassOf< ADataSto
 	return Singleton;
 }
 
+void UPersistentDataStore::SpawnSingletonAsync( TSubclassOf< ADataStoreSingleton > SingletonType, TFunction< void( ADataStoreSingleton* ) > &&OnSpawned, bool bDeferredSpawning )
+{
+	if (!ensureAlways( SingletonType != nullptr ))
+		return;
+
+	RequestOverrideClassFor( SingletonType.Get( ), [ WeakThis = TWeakObjectPtr( this ), SingletonType, OnSpawned = MoveTemp( OnSpawned ), bDeferredSpawning ]( TSubclassOf< ADataStoreActor > ) -> void
+	{
+		if (!WeakThis.IsValid( ) || WeakThis->bDeinitializing)
+		{
+			OnSpawned( nullptr );
+			return;
+		}
+
+		OnSpawned( WeakThis->SpawnSingleton( SingletonType, bDeferredSpawning ) );
+	} );
+}
+
 ADataStoreSingleton* UPersistentDataStore::SpawnDataStoreSingleton( const UObject *WorldContext, TSubclassOf< ADataStoreSingleton > SingletonType, bool bDeferredSpawning )
 {
 	const auto Subsystem = GetSubsystem( WorldContext );
@@ -209,11 +301,90 @@ ADataStoreSingleton* UPersistentDataStore::GetDataStoreSingleton( const UObject
 
 TSubclassOf<ADataStoreActor> UPersistentDataStore::GetOverrideClassFor( const TSubclassOf<ADataStoreActor> &BaseType )
 {
-	if (OverrideTypesLoading.IsValid( ) && !OverrideTypesLoading->HasLoadCompleted( ))
-		OverrideTypesLoading->WaitUntilComplete( );
+	if (!AreOverridesResolved( ))
+	{
+		// Only happens if there isn't a data store to have started the load
+		if (!OverrideTypesLoading.IsValid( ))
+			LoadClassOverrides( );
+
+		if (OverrideTypesLoading.IsValid( ))
+		{
+			UE_LOG( LogStarfireDataActors, Warning, TEXT( "Blocking on Data Store override types to resolve type '%s'. Use RequestOverrideClassFor or SpawnSingletonAsync to avoid the stall." ), *BaseType->GetName( ) );
+			OverrideTypesLoading->WaitUntilComplete( );
+		}
+
+		ApplyClassOverrides( );
+	}
 	
 	if (const auto Found = ClassOverrides.Find( BaseType ))
 		return *Found;
 
 	return BaseType;
 }
+
+void UPersistentDataStore::RequestOverrideClassFor( const TSubclassOf< ADataStoreActor > &BaseType, TFunction< void( TSubclassOf< ADataStoreActor > ) > &&OnResolved )
+{
+	if (!ensureAlways( BaseType != nullptr ))
+		return;
+
+	if (AreOverridesResolved( ))
+	{
+		OnResolved( GetOverrideClassFor( BaseType ) );
+		return;
+	}
+
+	PendingOverrideRequests.Push( [ BaseType, OnResolved = MoveTemp( OnResolved ) ]( ) -> void
+	{
+		OnResolved( GetOverrideClassFor( BaseType ) );
+	} );
+
+	// Only happens if there isn't a data store to have started the load
+	if (!OverrideTypesLoading.IsValid( ))
+		LoadClassOverrides( );
+}
+
+UDataStoreRecord* UPersistentDataStore::CreateRecord( TSubclassOf< UDataStoreRecord > RecordType )
+{
+	if (!ensureAlways( RecordType != nullptr ))
+		return nullptr;
+
+	const auto Record = NewObject< UDataStoreRecord >( this, RecordType );
+	Record->RecordGuid = FGuid::NewGuid( );
+
+	Records.Add( Record->RecordGuid, Record );
+
+	return Record;
+}
+
+UDataStoreRecord* UPersistentDataStore::CreateDataStoreRecord( const UObject *WorldContext, TSubclassOf< UDataStoreRecord > RecordType )
+{
+	const auto Subsystem = GetSubsystem( WorldContext );
+	check( Subsystem != nullptr );
+
+	return Subsystem->CreateRecord( RecordType );
+}
+
+UDataStoreRecord* UPersistentDataStore::GetRecord( const TSubclassOf< UDataStoreRecord > &RecordType, const FGuid &ID ) const
+{
+	if (!ensureAlways( RecordType != nullptr ))
+		return nullptr;
+
+	const auto Found = Records.Find( ID );
+	if (Found == nullptr)
+		return nullptr;
+
+	if (!(*Found)->IsA( RecordType ))
+		return nullptr;
+
+	return *Found;
+}
+
+void UPersistentDataStore::DestroyRecord( UDataStoreRecord *Record )
+{
+	if (Record == nullptr)
+		return;
+
+	ensureAlways( Record->GetOuter( ) == this );
+
+	Records.Remove( Record->RecordGuid );
+}
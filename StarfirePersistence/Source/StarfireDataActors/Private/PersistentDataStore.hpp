@@ -15,6 +15,15 @@ type_t* UPersistentDataStore::SpawnSingleton( const UObject *WorldContext, bool
 	return CastChecked< type_t >( SpawnSingleton( WorldContext, type_t::StaticClass( ), bDeferredSpawning ) );
 }
 
+template < SFstd::derived_from< ADataStoreSingleton > type_t >
+void UPersistentDataStore::SpawnSingletonAsync( TFunction< void( type_t* ) > &&OnSpawned, bool bDeferredSpawning )
+{
+	SpawnSingletonAsync( type_t::StaticClass( ), [ OnSpawned = MoveTemp( OnSpawned ) ]( ADataStoreSingleton *Singleton ) -> void
+	{
+		OnSpawned( CastChecked< type_t >( Singleton, ECastCheckedType::NullAllowed ) );
+	}, bDeferredSpawning );
+}
+
 template < SFstd::derived_from< ADataStoreActor > type_t >
 type_t* UPersistentDataStore::GetDataStoreActor( const FGuid &ID ) const
 {
@@ -37,4 +46,31 @@ template < SFstd::derived_from< ADataStoreActor > type_t >
 TSubclassOf< type_t > UPersistentDataStore::GetOverrideClassFor( void )
 {
 	return GetOverrideClassFor( type_t::StaticClass( ) ).Get( );
-}
\ No newline at end of file
+}
+
+template < SFstd::derived_from< ADataStoreActor > type_t >
+void UPersistentDataStore::RequestOverrideClassFor( TFunction< void( TSubclassOf< type_t > ) > &&OnResolved )
+{
+	RequestOverrideClassFor( type_t::StaticClass( ), [ OnResolved = MoveTemp( OnResolved ) ]( TSubclassOf< ADataStoreActor > Type ) -> void
+	{
+		OnResolved( Type.Get( ) );
+	} );
+}
+
+template < SFstd::derived_from< UDataStoreRecord > type_t >
+type_t* UPersistentDataStore::CreateRecord( void )
+{
+	return CastChecked< type_t >( CreateRecord( type_t::StaticClass( ) ) );
+}
+
+template < SFstd::derived_from< UDataStoreRecord > type_t >
+type_t* UPersistentDataStore::CreateRecord( const UObject *WorldContext )
+{
+	return CastChecked< type_t >( CreateDataStoreRecord( WorldContext, type_t::StaticClass( ) ) );
+}
+
+template < SFstd::derived_from< UDataStoreRecord > type_t >
+type_t* UPersistentDataStore::GetRecord( const FGuid &ID ) const
+{
+	return CastChecked< type_t >( GetRecord( type_t::StaticClass( ), ID ), ECastCheckedType::NullAllowed );
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "UObject/Object.h"
+
+#include "DataStoreRecord.generated.h"
+
+// Base class for data store entries that are only data and never need a presence in the world
+// A lighter weight alternative to Data Store Actors (no spawning, world registration, components or visualizers)
+UCLASS( Abstract, BlueprintType, Blueprintable )
+class STARFIREDATAACTORS_API UDataStoreRecord : public UObject
+{
+	GENERATED_BODY( )
+public:
+	// Get the GUID that uniquely identifies this record across sessions
+	UFUNCTION( BlueprintPure )
+	FGuid GetGuid( ) const { return RecordGuid; }
+
+	// UObject API
+	void Serialize( FArchive &Ar ) override;
+	UWorld* GetWorld( ) const override;
+
+private:
+	friend class UPersistentDataStore;
+
+	// GUID that uniquely identifies this record across sessions
+	UPROPERTY( VisibleInstanceOnly )
+	FGuid RecordGuid;
+};
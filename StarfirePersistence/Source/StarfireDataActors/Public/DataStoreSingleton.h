@@ -14,6 +14,7 @@ public:
 	// Actor API
 	void PostRegisterAllComponents( ) override;
 	void Destroyed( ) override;
+	void EndPlay( const EEndPlayReason::Type EndPlayReason ) override;
 	
 	// Data Store Actor API
 #if WITH_EDITOR
@@ -6,17 +6,20 @@
 
 #include "Templates/TypeUtilitiesSF.h"
 
+#include "StarfirePersistence/Public/PersistentSubsystemInterface.h"
+
 #include "PersistentDataStore.generated.h"
 
 class ADataStoreActor;
 class ADataStoreSingleton;
+class UDataStoreRecord;
 class UDataStoreSettings;
 struct FStreamableHandle;
 
 // Subsystem that collects all Data Store Actors and provides a single point of access for lookups
 // and singleton spawning
 UCLASS( )
-class STARFIREDATAACTORS_API UPersistentDataStore : public UWorldSubsystem, public TSubsystemNativeAccessors< UPersistentDataStore >
+class STARFIREDATAACTORS_API UPersistentDataStore : public UWorldSubsystem, public TSubsystemNativeAccessors< UPersistentDataStore >, public IPersistentSubsystem
 {
 	GENERATED_BODY( )
 public:
@@ -40,12 +43,42 @@ public:
 	template < SFstd::derived_from< ADataStoreSingleton > type_t >
 	[[nodiscard]] static type_t* GetSingleton( const UObject* WorldContext );
 
+	// Spawn a singleton data actor once the override types have finished loading (or immediately if they already have)
+	// OnSpawned is called with null if the data store is deinitialized before the override types finish loading
+	template < SFstd::derived_from< ADataStoreSingleton > type_t >
+	void SpawnSingletonAsync( TFunction< void( type_t* ) > &&OnSpawned, bool bDeferredSpawning = false );
+
 	// Get the data store actor class that should be spawned when planning to spawn a certain type
+	// Blocks until the override types have finished loading, use RequestOverrideClassFor to avoid the stall
 	template < SFstd::derived_from< ADataStoreActor > type_t >
 	[[nodiscard]] static TSubclassOf< type_t > GetOverrideClassFor( void );
 
+	// Get the data store actor class that should be spawned once the override types have finished loading (or immediately if they already have)
+	template < SFstd::derived_from< ADataStoreActor > type_t >
+	static void RequestOverrideClassFor( TFunction< void( TSubclassOf< type_t > ) > &&OnResolved );
+
+	// Whether the override types from the settings have finished loading and been applied
+	[[nodiscard]] static bool AreOverridesResolved( void );
+
+	// Create a data store record of a specific type
+	template < SFstd::derived_from< UDataStoreRecord > type_t >
+	type_t* CreateRecord( void );
+
+	// Create a data store record of a specific type
+	template < SFstd::derived_from< UDataStoreRecord > type_t >
+	static type_t* CreateRecord( const UObject* WorldContext );
+
+	// Retrieve a data store record with a specific ID
+	template < SFstd::derived_from< UDataStoreRecord > type_t >
+	[[nodiscard]] type_t* GetRecord( const FGuid &ID ) const;
+
+	// Remove a record from the data store
+	UFUNCTION( BlueprintCallable )
+	void DestroyRecord( UDataStoreRecord *Record );
+
 	// Subsystem API
 	void Initialize( FSubsystemCollectionBase &Collection ) override;
+	void Deinitialize( ) override;
 
 	// World Subsystem
 	bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
@@ -68,6 +101,10 @@ private:
 	UPROPERTY( VisibleInstanceOnly )
 	TMap< FGuid, TObjectPtr< ADataStoreActor > > Actors;
 
+	// The collection of data store records and their associated GUIDS
+	UPROPERTY( VisibleInstanceOnly, SaveGame )
+	TMap< FGuid, TObjectPtr< UDataStoreRecord > > Records;
+
 	// The collection of active singleton data store actors for given classes
 	UPROPERTY( VisibleInstanceOnly )
 	TMap< TObjectPtr< const UClass >, TObjectPtr< ADataStoreSingleton > > Singletons;
@@ -101,14 +138,52 @@ private:
 	UFUNCTION( BlueprintCallable, meta = (DeterminesOutputType = SingletonType, WorldContext = "WorldContext") )
 	static ADataStoreSingleton* GetDataStoreSingleton( const UObject *WorldContext, TSubclassOf< ADataStoreSingleton > SingletonType );
 
+	// Spawn a singleton data actor once the override types have finished loading (or immediately if they already have)
+	void SpawnSingletonAsync( TSubclassOf< ADataStoreSingleton > SingletonType, TFunction< void( ADataStoreSingleton* ) > &&OnSpawned, bool bDeferredSpawning = false );
+
 	// Get the data store actor class that should be spawned when planning to spawn a certain type
 	static TSubclassOf< ADataStoreActor > GetOverrideClassFor( const TSubclassOf< ADataStoreActor > &BaseType );
 
+	// Get the data store actor class that should be spawned once the override types have finished loading (or immediately if they already have)
+	static void RequestOverrideClassFor( const TSubclassOf< ADataStoreActor > &BaseType, TFunction< void( TSubclassOf< ADataStoreActor > ) > &&OnResolved );
+
+	// Start loading the override types from the settings (or apply them right away if there aren't any)
+	static void LoadClassOverrides( void );
+	// Fill in the ClassOverrides from the loaded types and run any requests that were waiting on them
+	static void ApplyClassOverrides( void );
+	// Restart the load if data stores still need the overrides, otherwise run any waiting requests with whatever types
+	// did load and reset so that a later data store can try loading them again
+	static void CancelClassOverrides( void );
+
+	// Create a data store record of a specific type
+	UFUNCTION( BlueprintCallable, meta = (DeterminesOutputType = RecordType) )
+	UDataStoreRecord* CreateRecord( TSubclassOf< UDataStoreRecord > RecordType );
+
+	// Create a data store record of a specific type
+	UFUNCTION( BlueprintCallable, meta = (DeterminesOutputType = RecordType, WorldContext = "WorldContext") )
+	static UDataStoreRecord* CreateDataStoreRecord( const UObject *WorldContext, TSubclassOf< UDataStoreRecord > RecordType );
+
+	// Retrieve a data store record with a specific ID
+	UFUNCTION( BlueprintCallable, meta = (DeterminesOutputType = RecordType) )
+	UDataStoreRecord* GetRecord( const TSubclassOf< UDataStoreRecord > &RecordType, const FGuid &ID ) const;
+
 	// Resource loading of the singleton types from the settings
 	static TSharedPtr< FStreamableHandle > OverrideTypesLoading;
 
 	// The mapping of blueprint types from the native data store actor types they should replace
 	static TMap< TSubclassOf< ADataStoreActor >, TSubclassOf< ADataStoreActor > > ClassOverrides;
+
+	// Whether ClassOverrides has been filled in from the loaded override types
+	static bool bClassOverridesApplied;
+
+	// Requests that are waiting for the override types to finish loading
+	static TArray< TFunction< void( ) > > PendingOverrideRequests;
+
+	// The number of data stores that are currently initialized (across all worlds)
+	static int32 NumInitializedStores;
+
+	// Whether this data store has started deinitializing and should no longer spawn singletons for async requests
+	bool bDeinitializing = false;
 };
 
 #if CPP
@@ -5,6 +5,7 @@
 enum class EPersistenceVersion : uint32
 {
 	Initial = 0,
+	SectionTable,	// Sections are located through a table of offsets instead of reading sequentially after the object data
 
 	// Add all format change versions above this entry
 	Current_Plus_One,
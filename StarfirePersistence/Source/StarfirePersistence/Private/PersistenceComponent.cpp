@@ -66,10 +66,26 @@ void UPersistenceComponent::InitializeComponent( )
 {
 	Super::InitializeComponent( );
 
-	if (bSpawned)
+	if (const auto Manager = UPersistenceManager::GetSubsystem( this ))
 	{
-		if (const auto Manager = UPersistenceManager::GetSubsystem( this ))
+		if (bSpawned)
 			Manager->AddSpawnedActor( GetOwner( ), GetGuid( ) );
+		else
+			Manager->AddLevelActor( GetOwner( ), GetGuid( ) );
+	}
+}
+
+void UPersistenceComponent::BeginPlay( )
+{
+	Super::BeginPlay( );
+
+	if (bSpawned)
+		return;
+
+	if (const auto Manager = UPersistenceManager::GetSubsystem( this ))
+	{
+		if (Manager->ShouldDestroyLevelActor( GetOwner( ), GetGuid( ) ))
+			GetOwner( )->Destroy( );
 	}
 }
 
@@ -86,10 +102,12 @@ void UPersistenceComponent::EndPlay( const EEndPlayReason::Type EndPlayReason )
 
 void UPersistenceComponent::UninitializeComponent( )
 {
-	if (bSpawned)
+	if (const auto Manager = UPersistenceManager::GetSubsystem( this ))
 	{
-		if (const auto Manager = UPersistenceManager::GetSubsystem( this ))
-			Manager->RemoveSpawnedActor( PersistentGuid );
+		if (bSpawned)
+			Manager->RemoveSpawnedActor( GetOwner( ), PersistentGuid );
+		else
+			Manager->RemoveLevelActor( GetOwner( ), PersistentGuid );
 	}
 
 	Super::UninitializeComponent( );
@@ -64,42 +64,110 @@ void UPersistenceManager::Deinitialize( )
 void UPersistenceManager::AddSpawnedActor( AActor *Actor, const FGuid &ID )
 {
 	PersistentActors.Add( ID, Actor );
+
+	IndexActor( Actor, ID );
 }
 
-void UPersistenceManager::RemoveSpawnedActor( const FGuid &ID )
+void UPersistenceManager::RemoveSpawnedActor( AActor *Actor, const FGuid &ID )
 {
 	PersistentActors.Remove( ID );
+
+	UnindexActor( Actor, ID );
+}
+
+void UPersistenceManager::AddLevelActor( AActor *Actor, const FGuid &ID )
+{
+	// Only actors from streaming levels are tracked, placed actors in the persistent level are not archived
+	if (!IsStreamingLevelActor( Actor ))
+		return;
+
+	IndexActor( Actor, ID );
+
+	// Destroyed actors are left for the component to destroy in BeginPlay, it isn't safe to do during component initialization
+	if (!DestroyedActors.Contains( ID ))
+		PersistentActors.Add( ID, Actor );
+}
+
+bool UPersistenceManager::ShouldDestroyLevelActor( const AActor *Actor, const FGuid &ID ) const
+{
+	if (!IsStreamingLevelActor( Actor ))
+		return false;
+
+	return DestroyedActors.Contains( ID );
+}
+
+bool UPersistenceManager::IsStreamingLevelActor( const AActor *Actor )
+{
+	const auto Level = Actor->GetLevel( );
+	if (Level == nullptr)
+		return false;
+
+	return !Level->IsPersistentLevel( );
+}
+
+void UPersistenceManager::RemoveLevelActor( AActor *Actor, const FGuid &ID )
+{
+	PersistentActors.Remove( ID );
+
+	UnindexActor( Actor, ID );
+}
+
+void UPersistenceManager::IndexActor( AActor *Actor, const FGuid &ID )
+{
+	const auto Level = Actor->GetLevel( );
+	if (Level == nullptr)
+		return;
+
+	LevelActors.FindOrAdd( Level ).Add( ID, Actor );
+}
+
+void UPersistenceManager::UnindexActor( const AActor *Actor, const FGuid &ID )
+{
+	const auto Level = Actor->GetLevel( );
+	if (Level == nullptr)
+		return;
+
+	const auto Indexed = LevelActors.Find( Level );
+	if (Indexed == nullptr)
+		return;
+
+	Indexed->Remove( ID );
+
+	if (Indexed->IsEmpty( ))
+		LevelActors.Remove( Level );
 }
 
 void UPersistenceManager::OnLevelVisible( UWorld *World, const ULevelStreaming *StreamingLevel, ULevel *LoadedLevel )
 {
-	for (const auto& A : LoadedLevel->Actors)
+	// Actors from levels that are loading for the first time haven't registered yet, they'll be handled by AddLevelActor instead
+	const auto Indexed = LevelActors.Find( LoadedLevel );
+	if (Indexed == nullptr)
+		return;
+
+	TArray< AActor*, TInlineAllocator< 16 > > ToDestroy;
+	for (const auto &[ ID, WeakActor ] : *Indexed)
 	{
+		const auto A = WeakActor.Get( );
 		if (A == nullptr)
 			continue;
-		
-		const auto Component = A->FindComponentByClass< UPersistenceComponent >( );
-		if (Component == nullptr)
-			continue;
 
-		if (DestroyedActors.Contains( Component->GetGuid(  ) ))
-			A->Destroy( );
+		if (DestroyedActors.Contains( ID ))
+			ToDestroy.Push( A );
 		else
-			PersistentActors.Add( Component->GetGuid( ), A );
+			PersistentActors.Add( ID, A );
 	}
+
+	// Done separately since destruction will update the index being iterated
+	for (const auto A : ToDestroy)
+		A->Destroy( );
 }
 
 void UPersistenceManager::OnLevelInvisible( UWorld *World, const ULevelStreaming *StreamingLevel, ULevel *LoadedLevel )
 {
-	for (const auto& A : LoadedLevel->Actors)
-	{
-		if (A == nullptr)
-			continue;
-		
-		const auto Component = A->FindComponentByClass< UPersistenceComponent >( );
-		if (Component == nullptr)
-			continue;
+	const auto Indexed = LevelActors.Find( LoadedLevel );
+	if (Indexed == nullptr)
+		return;
 
-		PersistentActors.Remove( Component->GetGuid( ) );
-	}
-}
\ No newline at end of file
+	for (const auto &[ ID, WeakActor ] : *Indexed)
+		PersistentActors.Remove( ID );
+}
@@ -17,11 +17,13 @@
 #include "GameFramework/GameStateBase.h"
 
 // Core
+#include "Async/ParallelFor.h"
 #include "Logging/StructuredLog.h"
 
 enum class ESectionID : uint32
 {
 	DestroyedActors = 0,
+	Objects = 1,
 };
 
 //*********************************************************************
@@ -35,6 +37,11 @@ FPersistentActorArchiver::FPersistentActorArchiver( FArchive &InInnerArchive, bo
 	FArchive::SetWantBinaryPropertySerialization( false );
 }
 
+const FPersistentActorArchiver::FSectionRecord* FPersistentActorArchiver::FindSection( ESectionID ID ) const
+{
+	return SectionTable.FindByPredicate( [ ID ]( const FSectionRecord &Record ) -> bool { return Record.ID == ID; } );
+}
+
 // *********************************************************************************************************************
 // Persistent Actor Writer Archive
 // *********************************************************************************************************************
@@ -45,6 +52,8 @@ FPersistentActorWriter::FPersistentActorWriter( FArchive& InInnerArchive ) :
 	FArchive::SetIsSaving( true );
 
 	Settings = GetDefault< UStarfirePersistenceSettings >( );
+
+	bParallelCollection = Settings->bParallelObjectCollection;
 }
 
 void FPersistentActorWriter::Archive( const UObject *WorldContext )
@@ -62,37 +71,90 @@ void FPersistentActorWriter::Archive( const UObject *WorldContext )
 	Manager->PersistentActors.GenerateValueArray( ArrayDownCast< AActor >( ToArchive ) );
 
 	// Find all the subsystems that want to persist
-	for (TObjectIterator< USubsystem > It; It; ++It)
-	{
-		if (It->GetWorld( ) != World)
-			continue;
-
-		if (!It->Implements< UPersistentSubsystem >( ))
-			continue;
-
-		ToArchive.Push( *It );
-	}
+	TArray< USubsystem* > PersistentSubsystems;
+	IPersistentSubsystem::GetPersistentSubsystems( World, PersistentSubsystems );
+	ToArchive.Append( PersistentSubsystems );
 
 	if (ObjectFilter)
 		ToArchive.RemoveAll( [ Filter = ObjectFilter ]( const UObject *O ) -> bool { return !Filter( O ); } );
 
-	Archive( ToArchive );
+	WriteHeader( );
+
+	ArchiveObjects( ToArchive );
 
 	SerializeDestroyedActors( Manager );
+
+	WriteSectionTable( );
 }
 
 void FPersistentActorWriter::Archive( const TArray< UObject* > &Objects )
 {
+	WriteHeader( );
+
+	ArchiveObjects( Objects );
+
+	WriteSectionTable( );
+}
+
+void FPersistentActorWriter::WriteHeader( void )
+{
+	check( SectionTable.IsEmpty( ) );
+
 	auto Version = EPersistenceVersion::Latest;
 	*this << Version;
 
+	// Reserve space for the location of the section table, which will be filled in once all the sections are written
+	SectionTableOffsetLocation = Tell( );
+
+	int64 SectionTableOffset = 0;
+	*this << SectionTableOffset;
+}
+
+void FPersistentActorWriter::WriteSectionTable( void )
+{
+	int64 SectionTableOffset = Tell( );
+	*this << SectionTable;
+
+	// seek back & write the table location then come back
+	const int64 FinalPos = Tell( );
+
+	Seek( SectionTableOffsetLocation );
+	*this << SectionTableOffset;
+
+	Seek( FinalPos );
+
+	// Reset this in case Archive is called repeatedly
+	SectionTable.Empty( );
+}
+
+void FPersistentActorWriter::BeginSection( ESectionID ID )
+{
+	check( !SectionTable.ContainsByPredicate( [ ID ]( const FSectionRecord &Record ) -> bool { return Record.ID == ID; } ) );
+
+	auto &Record = SectionTable.AddDefaulted_GetRef( );
+	Record.ID = ID;
+	Record.Offset = Tell( );
+}
+
+void FPersistentActorWriter::EndSection( void )
+{
+	check( !SectionTable.IsEmpty( ) );
+
+	auto &Record = SectionTable.Last( );
+	Record.Size = Tell( ) - Record.Offset;
+}
+
+void FPersistentActorWriter::ArchiveObjects( const TArray< UObject* > &Objects )
+{
 	check( ReferencedObjectList.IsEmpty( ) );
 
 	// Convert the object list into ObjectRecords
+	TArray< FPersistentObjectRecord > TopLevelRecords;
+	TopLevelRecords.Reserve( Objects.Num( ) );
 	for (const auto Obj : Objects)
 	{
-		auto& Entry = ReferencedObjectList.Emplace_GetRef( Obj );
-		ObjectToReferenceIndexMap.Add( Entry.Object, ReferencedObjectList.Num( ) - 1 );
+		auto& Entry = TopLevelRecords.Emplace_GetRef( Obj );
+		TopLevelObjects.Add( Entry.Object );
 
 		const auto Actor = Cast< AActor >( Obj );
 		const auto Component = Actor ? Actor->GetComponentByClass< UPersistenceComponent >( ) : nullptr;
@@ -105,8 +167,41 @@ void FPersistentActorWriter::Archive( const TArray< UObject* > &Objects )
 
 			Component->OnPreSerialize.Broadcast( );
 		}
+	}
+
+	// Gather the subobjects of each top level object. Hierarchies don't overlap (each object has a single Outer)
+	// so they can be collected independently while the game thread waits for the results
+	TArray< FCollectedHierarchy > Hierarchies;
+	Hierarchies.SetNum( TopLevelRecords.Num( ) );
+
+	const auto ParallelFlags = bParallelCollection ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread;
+	ParallelFor( TEXT( "PersistentActorWriter_Collect" ), TopLevelRecords.Num( ), 1, [ this, &TopLevelRecords, &Hierarchies ]( int32 Idx )
+	{
+		RecursiveCollectObjects( TopLevelRecords[ Idx ].Object, INDEX_NONE, Hierarchies[ Idx ], 0 );
+	}, ParallelFlags );
+
+	// Stitch the results together in order: each top level object followed by its hierarchy
+	int32 TotalRecords = TopLevelRecords.Num( );
+	for (const auto &Hierarchy : Hierarchies)
+		TotalRecords += Hierarchy.Records.Num( );
+
+	ReferencedObjectList.Reserve( TotalRecords );
+	ObjectToReferenceIndexMap.Reserve( TotalRecords );
+
+	for (int32 Idx = 0; Idx < TopLevelRecords.Num( ); ++Idx)
+	{
+		const int32 TopLevelIndex = ReferencedObjectList.Num( );
+		ObjectToReferenceIndexMap.Add( TopLevelRecords[ Idx ].Object, TopLevelIndex );
+		ReferencedObjectList.Push( MoveTemp( TopLevelRecords[ Idx ] ) );
 
-		RecursiveCollectObjects( Entry.Object, Component, 0 );
+		for (auto &Record : Hierarchies[ Idx ].Records)
+		{
+			// Convert from the index in the hierarchy to the index in the complete list
+			Record.OuterIndex = (Record.OuterIndex == INDEX_NONE) ? TopLevelIndex : (TopLevelIndex + 1 + Record.OuterIndex);
+
+			ObjectToReferenceIndexMap.Add( Record.Object, ReferencedObjectList.Num( ) );
+			ReferencedObjectList.Push( MoveTemp( Record ) );
+		}
 	}
 
 #if !UE_BUILD_SHIPPING
@@ -115,6 +210,8 @@ void FPersistentActorWriter::Archive( const TArray< UObject* > &Objects )
 		BucketMapping.FindOrAdd( E.ClassPtr.Get( ) ).Push( E.Object );
 #endif
 
+	BeginSection( ESectionID::Objects );
+
 	*this << ReferencedObjectList;
 
 	// Then write all the actual object data
@@ -156,34 +253,24 @@ void FPersistentActorWriter::Archive( const TArray< UObject* > &Objects )
 			SavedObjectClasses.Add( Entry.ClassPtr );
 	}
 
+	EndSection( );
+
 	// Reset these in case Archive is called repeatedly
 	ReferencedObjectList.Empty( );
 	ObjectToReferenceIndexMap.Empty( );
+	TopLevelObjects.Empty( );
 }
 
 void FPersistentActorWriter::SerializeDestroyedActors( UPersistenceManager *Manager )
 {
 	if (Manager->DestroyedActors.IsEmpty( ))
 		return;
-	
-	ESectionID SectionID = ESectionID::DestroyedActors;
-	*this << SectionID;
-
-	const auto SizeLocation = Tell( );
 
-	int Size = 0;
-	*this << Size;
-	const auto SizeStart = Tell( );
+	BeginSection( ESectionID::DestroyedActors );
 
 	*this << Manager->DestroyedActors;
 
-	const auto FinalPos = Tell( );
-
-	Seek( SizeLocation );
-	int FinalSize = FinalPos - SizeStart;
-	*this << FinalSize;
-
-	Seek( FinalPos );
+	EndSection( );
 }
 
 FArchive& FPersistentActorWriter::operator<<( FSoftObjectPtr &Value )
@@ -234,7 +321,7 @@ bool FPersistentActorWriter::ShouldIncludeComponent( const UActorComponent *Comp
 	return true;
 }
 
-void FPersistentActorWriter::RecursiveCollectObjects( UObject *Target, const UPersistenceComponent *Component, int32 CurrentDepth )
+void FPersistentActorWriter::RecursiveCollectObjects( UObject *Target, int32 TargetIndex, FCollectedHierarchy &Hierarchy, int32 CurrentDepth ) const
 {
 	if (CurrentDepth >= ArchiveUtilities::MaxRecursionDepth)
 	{
@@ -247,19 +334,19 @@ void FPersistentActorWriter::RecursiveCollectObjects( UObject *Target, const UPe
 	FReferenceFinder ObjectReferenceCollector( LocalCollectedReferences, nullptr, false, true, true, true );
 	ObjectReferenceCollector.FindReferences( Target );
 
-	const auto StartingListSize = ReferencedObjectList.Num( );
+	const auto StartingListSize = Hierarchy.Records.Num( );
 	for (const auto Reference : LocalCollectedReferences)
 	{
 		if (Reference == nullptr)
 			continue;
 
-		if (ObjectToReferenceIndexMap.Contains( Reference ))
-			continue; // element already tracked, can skip this time
-
 		const auto bIsInHierarchy = (Reference->GetOuter( ) == Target);
 		if (!bIsInHierarchy)
 			continue;
 
+		if (TopLevelObjects.Contains( Reference ) || Hierarchy.ObjectToRecordIndexMap.Contains( Reference ))
+			continue; // element already tracked, can skip this time
+
 		if (const auto ComponentRef = Cast< UActorComponent >( Reference ))
 		{
 			if (!ShouldIncludeComponent( ComponentRef ))
@@ -270,35 +357,28 @@ void FPersistentActorWriter::RecursiveCollectObjects( UObject *Target, const UPe
 			continue;
 		}
 
-		const auto OuterIndex = ObjectToReferenceIndexMap.Find( Reference->GetOuter( ) );
-		check( OuterIndex != nullptr ); // should have found the outer by this point
+		auto &Entry = Hierarchy.Records.Emplace_GetRef( Reference );
 
-		auto &Entry = ReferencedObjectList.Emplace_GetRef( Reference );
+		Entry.OuterIndex = TargetIndex;
 
-		Entry.OuterIndex = *OuterIndex;
-
-		if (bIsInHierarchy)
-		{
-			if (Reference->IsA< UActorComponent >( ))
-				Entry.SubobjectName = Reference->GetFName( );
-			else if (ReferencedObjectList[ *OuterIndex ].Subobjects.Contains( Reference ))
-				Entry.SubobjectName = Reference->GetFName( );
-		}
+		if (Reference->IsA< UActorComponent >( ))
+			Entry.SubobjectName = Reference->GetFName( );
+		else if ((TargetIndex != INDEX_NONE) && Hierarchy.Records[ TargetIndex ].Subobjects.Contains( Reference ))
+			Entry.SubobjectName = Reference->GetFName( );
 		
 		FReferenceFinder SubobjectCollector( Entry.Subobjects, Entry.Object, true, true, true, true );
 		SubobjectCollector.FindReferences( Entry.Object );
 
-		// Do this after using OuterIndex in case the add causes the reference to be invalidated
-		ObjectToReferenceIndexMap.Add( Reference, ReferencedObjectList.Num( ) - 1 );
+		Hierarchy.ObjectToRecordIndexMap.Add( Reference, Hierarchy.Records.Num( ) - 1 );
 	}
-	const int32 EndingListSize = ReferencedObjectList.Num( );
+	const int32 EndingListSize = Hierarchy.Records.Num( );
 
 	// Now recurse down into the hierarchy. This is done in two steps, making the setting of class infos and map indices breadth first
 	++CurrentDepth;
 	for (int32 idx = StartingListSize; idx < EndingListSize; ++idx)
 	{
-		UObject *Reference = ReferencedObjectList[ idx ].Object;
-		RecursiveCollectObjects( Reference, nullptr, CurrentDepth );
+		UObject *Reference = Hierarchy.Records[ idx ].Object;
+		RecursiveCollectObjects( Reference, idx, Hierarchy, CurrentDepth );
 	}
 }
 
@@ -313,282 +393,466 @@ FPersistentActorReader::FPersistentActorReader( FArchive& InInnerArchive ) :
 }
 
 void FPersistentActorReader::Archive( const UObject *WorldContext )
+{
+	BeginArchive( WorldContext );
+
+	StepArchive( TNumericLimits< double >::Max( ) );
+	check( Phase == EReadPhase::Complete );
+}
+
+void FPersistentActorReader::BeginArchive( const UObject *WorldContext )
 {
 	check( WorldContext != nullptr );
 	check( ReferencedObjectList.IsEmpty( ) );
-	
-	EPersistenceVersion Version;
-	*this << Version;
+	check( !IsArchiving( ) );
 
-	UWorld* World = GEngine->GetWorldFromContextObject( WorldContext, EGetWorldErrorMode::LogAndReturnNull );
-	check( World != nullptr );
+	World = GEngine->GetWorldFromContextObject( WorldContext, EGetWorldErrorMode::LogAndReturnNull );
+	check( World.IsValid( ) );
 
 	Manager = UPersistenceManager::GetSubsystem( WorldContext );
 
+	ReadHeader( );
+
+	if (const auto ObjectsSection = FindSection( ESectionID::Objects ))
+		Seek( ObjectsSection->Offset );
+
 	// Build a mapping of all the subsystems that are persistent
-	TMap< UClass*, USubsystem* > PersistentSubsystems;
-	for (TObjectIterator< USubsystem > It; It; ++It)
-	{
-		if (It->GetWorld( ) != World)
-			continue;
+	TArray< USubsystem* > RegisteredSubsystems;
+	IPersistentSubsystem::GetPersistentSubsystems( World.Get( ), RegisteredSubsystems );
 
-		if (!It->Implements< UPersistentSubsystem >( ))
-			continue;
+	for (const auto Subsystem : RegisteredSubsystems)
+		PersistentSubsystems.Add( Subsystem->GetClass( ), Subsystem );
+
+	*this << ReferencedObjectList;
+
+	ActorResults.Reserve( ReferencedObjectList.Num( ) );
+
+	Phase = EReadPhase::Construct;
+	PhaseIndex = 0;
+}
+
+bool FPersistentActorReader::TickArchive( double MaxTimePerFrame_s )
+{
+	check( IsInGameThread( ) );
 
-		PersistentSubsystems.Add( It->GetClass( ), *It );
+	if (Phase == EReadPhase::Complete)
+		return true;
+
+	check( Phase != EReadPhase::None ); // BeginArchive needs to be called first
+
+	if (!World.IsValid( ))
+	{
+		UE_LOGFMT( LogStarfirePersistence, Warning, "PersistentActorReader world was destroyed while time-sliced restore was {0}% complete. Abandoning restore.", (int)(GetProgress( ) * 100.0f) );
+		ResetArchive( );
+		Phase = EReadPhase::Complete;
+		return true;
 	}
 
-	*this << ReferencedObjectList;
+	if (MaxTimePerFrame_s <= 0.0)
+		MaxTimePerFrame_s = GetDefault< UStarfirePersistenceSettings >( )->TimeSlicedRestoreBudget_s;
+
+	StepArchive( FPlatformTime::Seconds( ) + MaxTimePerFrame_s );
+
+	return (Phase == EReadPhase::Complete);
+}
+
+float FPersistentActorReader::GetProgress( ) const
+{
+	if (Phase == EReadPhase::Complete)
+		return 1.0f;
+
+	if (Phase == EReadPhase::None)
+		return 0.0f;
+
+	// Each entry is stepped once in each of the Construct, Serialize & Finalize phases
+	const int32 TotalSteps = ReferencedObjectList.Num( ) * 3;
+	if (TotalSteps == 0)
+		return 0.0f;
+
+	const int32 PhaseOrdinal = static_cast< int32 >( Phase ) - static_cast< int32 >( EReadPhase::Construct );
+	const int32 CompletedSteps = PhaseOrdinal * ReferencedObjectList.Num( ) + PhaseIndex;
+
+	return FMath::Clamp( (float)CompletedSteps / TotalSteps, 0.0f, 1.0f );
+}
+
+void FPersistentActorReader::StepArchive( double EndTime )
+{
+	while (Phase != EReadPhase::Complete)
+	{
+		if (ReferencedObjectList.IsValidIndex( PhaseIndex ))
+		{
+			FPersistentObjectRecord &Entry = ReferencedObjectList[ PhaseIndex++ ];
+
+			switch (Phase)
+			{
+				case EReadPhase::Construct:
+					ConstructEntry( Entry );
+					break;
+
+				case EReadPhase::Serialize:
+					SerializeEntry( Entry );
+					break;
+
+				case EReadPhase::Finalize:
+					FinalizeEntry( Entry );
+					break;
+
+				default:
+					checkNoEntry( );
+					break;
+			}
+		}
+		else
+		{
+			Phase = static_cast< EReadPhase >( static_cast< uint8 >( Phase ) + 1 );
+			PhaseIndex = 0;
 
+			if (Phase == EReadPhase::Complete)
+				FinishArchive( );
+		}
+
+		if (FPlatformTime::Seconds( ) >= EndTime)
+			break;
+	}
+}
+
+void FPersistentActorReader::ConstructEntry( FPersistentObjectRecord &Entry )
+{
 	// Associate each entry with an object
 	// Spawn an Actor, create an object, find an existing actor/component/subsystem
-	TArray< FArchivedActor > ActorResults;
-	ActorResults.Reserve( ReferencedObjectList.Num( ) );
-	for (FPersistentObjectRecord& Entry : ReferencedObjectList)
+
+	// Determine the object that should be the outer (outer should always be at a lower index)
+	UObject* Outer = GetTransientPackage();
+	const FPersistentObjectRecord* OuterRecord = nullptr;
+	if (ReferencedObjectList.IsValidIndex( Entry.OuterIndex ))
+	{
+		OuterRecord = &ReferencedObjectList[ Entry.OuterIndex ];
+		Outer = OuterRecord->Object;
+
+		if (Outer == nullptr)
+		{
+			const auto& OuterInfo = ReferencedObjectList[ Entry.OuterIndex ];
+			UE_LOGFMT( LogStarfirePersistence, Warning, "Unable to construct object of type \"{0}\" in PersistentActorReader. Uses outer of type \"{1}\" which could not be constructed.", Entry.ClassPtr.ToString( ), OuterInfo.ClassPtr.GetAssetName( ) );
+			return;
+		}
+	}
+
+	if (Entry.PersistentID.IsValid( ) && !Entry.bWasSpawned)
+	{
+		auto Actor = Manager->FindActor( Entry.PersistentID );
+		Entry.Object = Actor.Get( nullptr );
+		if (Entry.Object == nullptr)
+		{
+			UE_LOGFMT( LogStarfirePersistence, Warning, "Unable to find persistent actor of type \"{0}\" with ID \"{1}\" in PersistentActorReader", Entry.ClassPtr.ToString( ), Entry.PersistentID );
+		}
+		else
+		{
+			ActorResults.AddUninitialized( );
+			ActorResults.Last( ).Actor = Actor.GetValue( );
+			ActorResults.Last( ).Type = EArchivedActorType::Updated;
+		}
+
+		Entry.bWasConstructed = (Entry.Object != nullptr);
+	}
+	else if (const auto LoadedClass = Entry.ClassPtr.LoadSynchronous( ))
 	{
-		// Determine the object that should be the outer (outer should always be at a lower index)
-		UObject* Outer = GetTransientPackage();
-		const FPersistentObjectRecord* OuterRecord = nullptr;
-		if (ReferencedObjectList.IsValidIndex( Entry.OuterIndex ))
+		if (LoadedClass->IsChildOf< AGameModeBase >( ))
 		{
-			OuterRecord = &ReferencedObjectList[ Entry.OuterIndex ];
-			Outer = OuterRecord->Object;
+			Entry.Object = World->GetAuthGameMode( );
+			Entry.bWasSpawned = false; // technically it was spawned, but *this* process didn't spawn it, and we don't want to call FinishSpawning on the GameState in the next step
+			if (Entry.Object == nullptr)
+			{
+				UE_LOGFMT( LogStarfirePersistence, Error, "Unable to find GameMode while reading from PersistentActorReader." );
+				return;
+			}
 
-			if (Outer == nullptr)
+			if (!Entry.Object->IsA( LoadedClass ))
 			{
-				const auto& OuterInfo = ReferencedObjectList[ Entry.OuterIndex ];
-				UE_LOGFMT( LogStarfirePersistence, Warning, "Unable to construct object of type \"{0}\" in PersistentActorReader. Uses outer of type \"{1}\" which could not be constructed.", Entry.ClassPtr.ToString( ), OuterInfo.ClassPtr.GetAssetName( ) );
-				continue;
+				Entry.Object = nullptr; // don't try to serialize into a different type
+				UE_LOGFMT( LogStarfirePersistence, Warning, "World's Game Mode is no longer the expected type of \"{0}\".", Entry.ClassPtr.ToString( ) );
+				return;
 			}
-		}
 
-		if (Entry.PersistentID.IsValid( ) && !Entry.bWasSpawned)
+			ActorResults.AddUninitialized( );
+			ActorResults.Last( ).Actor = World->GetGameState( );
+			ActorResults.Last( ).Type = EArchivedActorType::Updated;
+		}
+		else if (LoadedClass->IsChildOf< AGameStateBase >( ))
 		{
-			auto Actor = Manager->FindActor( Entry.PersistentID );
-			Entry.Object = Actor.Get( nullptr );
+			Entry.Object = World->GetGameState( );
+			Entry.bWasSpawned = false; // technically it was spawned, but *this* process didn't spawn it, and we don't want to call FinishSpawning on the GameState in the next step
 			if (Entry.Object == nullptr)
 			{
-				UE_LOGFMT( LogStarfirePersistence, Warning, "Unable to find persistent actor of type \"{0}\" with ID \"{1}\" in PersistentActorReader", Entry.ClassPtr.ToString( ), Entry.PersistentID );
+				UE_LOGFMT( LogStarfirePersistence, Error, "Unable to find GameState while reading from PersistentActorReader." );
+				return;
 			}
-			else
+
+			if (!Entry.Object->IsA( LoadedClass ))
 			{
-				ActorResults.AddUninitialized( );
-				ActorResults.Last( ).Actor = Actor.GetValue( );
-				ActorResults.Last( ).Type = EArchivedActorType::Updated;
+				Entry.Object = nullptr; // don't try to serialize into a different type
+				UE_LOGFMT( LogStarfirePersistence, Warning, "World's Game State is no longer the expected type of \"{0}\".", Entry.ClassPtr.ToString( ) );
+				return;
 			}
 
-			Entry.bWasConstructed = (Entry.Object != nullptr);
+			ActorResults.AddUninitialized( );
+			ActorResults.Last( ).Actor = World->GetGameState( );
+			ActorResults.Last( ).Type = EArchivedActorType::Updated;
 		}
-		else if (const auto LoadedClass = Entry.ClassPtr.LoadSynchronous( ))
+		else if (LoadedClass->IsChildOf< AActor >( ))
 		{
-			if (LoadedClass->IsChildOf< AGameModeBase >( ))
+			FActorSpawnParameters SpawnInfo;
+			SpawnInfo.bDeferConstruction = true;
+			SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			const auto Actor = World->SpawnActor( LoadedClass, &FTransform::Identity, SpawnInfo );
+			Entry.Object = Actor;
+			
+			ActorResults.AddUninitialized( );
+			ActorResults.Last( ).Actor = Actor;
+			ActorResults.Last( ).Type = EArchivedActorType::Spawned;
+		}
+		else if (LoadedClass->IsChildOf< UActorComponent >( ))
+		{
+			const auto ActorOuter = CastChecked< AActor >( Outer ); // if we got one this must be true, right?
+
+			Entry.Object = ArchiveUtilities::FindComponentByName( ActorOuter, Entry.SubobjectName );
+			if (Entry.Object == nullptr)
 			{
-				Entry.Object = World->GetAuthGameMode( );
-				Entry.bWasSpawned = false; // technically it was spawned, but *this* process didn't spawn it, and we don't want to call FinishSpawning on the GameState in the next step
-				if (Entry.Object == nullptr)
-				{
-					UE_LOGFMT( LogStarfirePersistence, Error, "Unable to find GameMode while reading from PersistentActorReader." );
-					continue;
-				}
-
-				if (!Entry.Object->IsA( LoadedClass ))
-				{
-					Entry.Object = nullptr; // don't try to serialize into a different type
-					UE_LOGFMT( LogStarfirePersistence, Warning, "World's Game Mode is no longer the expected type of \"{0}\".", Entry.ClassPtr.ToString( ) );
-					continue;
-				}
-
-				ActorResults.AddUninitialized( );
-				ActorResults.Last( ).Actor = World->GetGameState( );
-				ActorResults.Last( ).Type = EArchivedActorType::Updated;
+				Entry.Object = NewObject< UObject >( Outer, LoadedClass, Entry.SubobjectName );
+				ActorOuter->AddOwnedComponent( CastChecked< UActorComponent >( Entry.Object ) );
 			}
-			else if (LoadedClass->IsChildOf< AGameStateBase >( ))
+		}
+		else if (LoadedClass->IsChildOf< USubsystem >( ))
+		{
+			if (const auto Subsystem = PersistentSubsystems.Find( LoadedClass ))
 			{
-				Entry.Object = World->GetGameState( );
-				Entry.bWasSpawned = false; // technically it was spawned, but *this* process didn't spawn it, and we don't want to call FinishSpawning on the GameState in the next step
-				if (Entry.Object == nullptr)
-				{
-					UE_LOGFMT( LogStarfirePersistence, Error, "Unable to find GameState while reading from PersistentActorReader." );
-					continue;
-				}
-
-				if (!Entry.Object->IsA( LoadedClass ))
-				{
-					Entry.Object = nullptr; // don't try to serialize into a different type
-					UE_LOGFMT( LogStarfirePersistence, Warning, "World's Game State is no longer the expected type of \"{0}\".", Entry.ClassPtr.ToString( ) );
-					continue;
-				}
-
-				ActorResults.AddUninitialized( );
-				ActorResults.Last( ).Actor = World->GetGameState( );
-				ActorResults.Last( ).Type = EArchivedActorType::Updated;
+				Entry.Object = *Subsystem;
 			}
-			else if (LoadedClass->IsChildOf< AActor >( ))
+			else
 			{
-				FActorSpawnParameters SpawnInfo;
-				SpawnInfo.bDeferConstruction = true;
-				SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-				const auto Actor = World->SpawnActor( LoadedClass, &FTransform::Identity, SpawnInfo );
-				Entry.Object = Actor;
-				
-				ActorResults.AddUninitialized( );
-				ActorResults.Last( ).Actor = Actor;
-				ActorResults.Last( ).Type = EArchivedActorType::Spawned;
+				UE_LOGFMT( LogStarfirePersistence, Warning, "Failed to find persistent subsystem of type \"{0}\" in PersistentActorReader.", Entry.ClassPtr.ToString( ) );
+				return;
 			}
-			else if (LoadedClass->IsChildOf< UActorComponent >( ))
+		}
+		else
+		{
+			if (Entry.SubobjectName.IsNone( ))
 			{
-				const auto ActorOuter = CastChecked< AActor >( Outer ); // if we got one this must be true, right?
-
-				Entry.Object = ArchiveUtilities::FindComponentByName( ActorOuter, Entry.SubobjectName );
-				if (Entry.Object == nullptr)
-				{
-					Entry.Object = NewObject< UObject >( Outer, LoadedClass, Entry.SubobjectName );
-					ActorOuter->AddOwnedComponent( CastChecked< UActorComponent >( Entry.Object ) );
-				}
+				Entry.Object = NewObject< UObject >( Outer, LoadedClass );
 			}
-			else if (LoadedClass->IsChildOf< USubsystem >( ))
+			else if (OuterRecord != nullptr)
 			{
-				if (const auto Subsystem = PersistentSubsystems.Find( LoadedClass ))
-				{
-					Entry.Object = *Subsystem;
-				}
-				else
-				{
-					UE_LOGFMT( LogStarfirePersistence, Warning, "Failed to find persistent subsystem of type \"{0}\" in PersistentActorReader.", Entry.ClassPtr.ToString( ) );
-					continue;
-				}
+				Entry.Object = ArchiveUtilities::FindObjectByName( OuterRecord->Subobjects, Entry.SubobjectName );
+				if (Entry.Object == nullptr) // must not be a default subobject, so we'll spawn it instead
+					Entry.Object = NewObject< UObject >( Outer, LoadedClass );
 			}
 			else
 			{
-				if (Entry.SubobjectName.IsNone( ))
-				{
-					Entry.Object = NewObject< UObject >( Outer, LoadedClass );
-				}
-				else if (OuterRecord != nullptr)
-				{
-					Entry.Object = ArchiveUtilities::FindObjectByName( OuterRecord->Subobjects, Entry.SubobjectName );
-					if (Entry.Object == nullptr) // must not be a default subobject, so we'll spawn it instead
-						Entry.Object = NewObject< UObject >( Outer, LoadedClass );
-				}
-				else
-				{
-					UE_LOGFMT( LogStarfirePersistence, Warning, "Failed to find Outer for \"{0}\" sub-object in PersistentActorReader.", Entry.ClassPtr.ToString( ) );
-					continue;
-				}
+				UE_LOGFMT( LogStarfirePersistence, Warning, "Failed to find Outer for \"{0}\" sub-object in PersistentActorReader.", Entry.ClassPtr.ToString( ) );
+				return;
 			}
+		}
 
-			check( Entry.Object != nullptr );
-			Entry.bWasConstructed = true;
+		check( Entry.Object != nullptr );
+		Entry.bWasConstructed = true;
 
-			FReferenceFinder SubobjectCollector( Entry.Subobjects, Entry.Object, true, true, true, true );
-			SubobjectCollector.FindReferences( Entry.Object );
-		}
-		else
-		{
-			UE_LOGFMT( LogStarfirePersistence, Error, "Unable to construct object of type \"{0}\" in PersistentActorReader", Entry.ClassPtr.ToString( ) );
-		}
+		FReferenceFinder SubobjectCollector( Entry.Subobjects, Entry.Object, true, true, true, true );
+		SubobjectCollector.FindReferences( Entry.Object );
+	}
+	else
+	{
+		UE_LOGFMT( LogStarfirePersistence, Error, "Unable to construct object of type \"{0}\" in PersistentActorReader", Entry.ClassPtr.ToString( ) );
 	}
+}
 
-#if !UE_BUILD_SHIPPING
-	// A helpful debugging view of the serialized objects bucketed by type
-	TMap< const UClass*, TArray< UObject* > > DebuggingLookup;
-	// Debugging view of the serialized sizes (uncompressed) of the objects in the save
-	// Size key is the lower bound log10 of the BlockSize ([0:9] -> 1, [10:99] -> 10, [100:999] -> 100, etc)
-	TMap< int, TMap< TSoftClassPtr< UObject >, TArray< int > > > SizeBuckets;
-#endif
+void FPersistentActorReader::SerializeEntry( const FPersistentObjectRecord &Entry )
+{
 	// Serialize each of the objects actual properties
 	// Done separately so that circular references are serialized properly
 	// (since those only need the object to exist, not be filled in)
-	TMap< UObject*, FTransform > ActorTransforms;
-	for (const FPersistentObjectRecord& Entry : ReferencedObjectList)
-	{
-		int64 BlockSize = 0;
-		*this << BlockSize;
+	int64 BlockSize = 0;
+	*this << BlockSize;
 
 #if !UE_BUILD_SHIPPING
-		const auto Log10 = (int)FMath::LogX( 10.0f, BlockSize );
-		
-		auto& Bucket = SizeBuckets.FindOrAdd( (int)FMath::Pow( 10.0, Log10 ) );
-		Bucket.FindOrAdd( Entry.ClassPtr ).Push( BlockSize );
+	const auto Log10 = (int)FMath::LogX( 10.0f, BlockSize );
+	
+	auto& Bucket = SizeBuckets.FindOrAdd( (int)FMath::Pow( 10.0, Log10 ) );
+	Bucket.FindOrAdd( Entry.ClassPtr ).Push( BlockSize );
 #endif
 
-		if (Entry.Object != nullptr)
-		{
+	if (Entry.Object != nullptr)
+	{
 #if !UE_BUILD_SHIPPING
-			DebuggingLookup.FindOrAdd( Entry.ClassPtr.Get() ).Push( Entry.Object );
+		DebuggingLookup.FindOrAdd( Entry.ClassPtr.Get() ).Push( Entry.Object );
 #endif
 
-			const int64 BlockStart = Tell( );
+		const int64 BlockStart = Tell( );
 
-			ArIsSaveGame = Entry.bUseSaveGame;
+		ArIsSaveGame = Entry.bUseSaveGame;
 
-			Entry.Object->Serialize( *this );
-			
-			if (AActor* Actor = Cast< AActor >( Entry.Object ))
+		Entry.Object->Serialize( *this );
+		
+		if (AActor* Actor = Cast< AActor >( Entry.Object ))
+		{
+			AActor* Owner = nullptr;
+			*this << Owner;
+
+			Actor->SetOwner( Owner );
+
+			const auto Component = Actor ? Actor->GetComponentByClass< UPersistenceComponent >( ) : nullptr;
+			if ((Component != nullptr) && (Component->bPersistTransform))
 			{
-				AActor* Owner = nullptr;
-				*this << Owner;
-
-				Actor->SetOwner( Owner );
-
-				const auto Component = Actor ? Actor->GetComponentByClass< UPersistenceComponent >( ) : nullptr;
-				if ((Component != nullptr) && (Component->bPersistTransform))
-				{
-					FTransform ActorTransform;
-					*this << ActorTransform;
-
-					ActorTransforms.Add( Actor, ActorTransform );
-				}
-				else
-				{
-					ActorTransforms.Add( Actor, FTransform::Identity );
-				}
-			}
+				FTransform ActorTransform;
+				*this << ActorTransform;
 
-			const int64 BlockEnd = Tell( );
-			ensureAlways( (BlockEnd - BlockStart) == BlockSize );
-		}
-		else
-		{
-			// something's went wrong, skip over this object's data
-			Seek( Tell( ) + BlockSize );
+				ActorTransforms.Add( Actor, ActorTransform );
+			}
+			else
+			{
+				ActorTransforms.Add( Actor, FTransform::Identity );
+			}
 		}
+
+		const int64 BlockEnd = Tell( );
+		ensureAlways( (BlockEnd - BlockStart) == BlockSize );
 	}
+	else
+	{
+		// something's went wrong, skip over this object's data
+		Seek( Tell( ) + BlockSize );
+	}
+}
 
+void FPersistentActorReader::FinalizeEntry( const FPersistentObjectRecord &Entry )
+{
 	// Finalize each object (depending on the type of the object)
 	// Done separately so that references through pointers do have all their data available to use
-	for (const FPersistentObjectRecord& Entry : ReferencedObjectList)
+	if (Entry.Object == nullptr)
+		return;
+
+	if (const auto Actor = Cast< AActor >( Entry.Object ))
 	{
-		if (Entry.Object == nullptr)
-			continue;
+		const auto& ActorTransform = ActorTransforms.FindRef( Entry.Object );
 
-		if (const auto Actor = Cast< AActor >( Entry.Object ))
+		if (Entry.bWasSpawned)
+			Actor->FinishSpawning( ActorTransform );
+		else
+			Actor->SetActorTransform( ActorTransform );
+
+		if (const auto Component = Actor->GetComponentByClass< UPersistenceComponent >())
+			Component->OnPostDeserialize.Broadcast( );
+	}
+	else if (const auto Component = Cast< UActorComponent >( Entry.Object ))
+	{
+		if (!Component->IsRegistered( ))
+			Component->RegisterComponent( );
+	}
+	else if (const auto Interface = Cast< IPersistentSubsystem >( Entry.Object ))
+	{
+		Interface->PostDeserialize( );
+	}
+}
+
+void FPersistentActorReader::FinishArchive( void )
+{
+	if (Version < EPersistenceVersion::SectionTable)
+	{
+		ReadLegacySections( );
+	}
+	else
+	{
+		for (const auto &Section : SectionTable)
 		{
-			const auto& ActorTransform = ActorTransforms.FindRef( Entry.Object );
+			switch (Section.ID)
+			{
+				case ESectionID::Objects:
+					break; // already handled by the phases
 
-			if (Entry.bWasSpawned)
-				Actor->FinishSpawning( ActorTransform );
-			else
-				Actor->SetActorTransform( ActorTransform );
+				case ESectionID::DestroyedActors:
+					Seek( Section.Offset );
+					SerializeDestroyedActors( );
+					break;
 
-			if (const auto Component = Actor->GetComponentByClass< UPersistenceComponent >())
-				Component->OnPostDeserialize.Broadcast( );
+				default:
+					UE_LOGFMT( LogStarfirePersistence, Warning, "PersistentActorReader found unknown SectionID {0}. Skipping {1} bytes", static_cast< int >(Section.ID), Section.Size );
+					break;
+			}
 		}
-		else if (const auto Component = Cast< UActorComponent >( Entry.Object ))
+	}
+
+	for (const FPersistentObjectRecord& Entry : ReferencedObjectList)
+	{
+		if (const auto Actor = Cast< AActor >( Entry.Object ))
 		{
-			if (!Component->IsRegistered( ))
-				Component->RegisterComponent( );
+			if (const auto Component = Actor->GetComponentByClass< UPersistenceComponent >())
+				Component->OnPostArchive.Broadcast( ActorResults );
 		}
 		else if (const auto Interface = Cast< IPersistentSubsystem >( Entry.Object ))
 		{
-			Interface->PostDeserialize( );
+			Interface->PostArchiveLoad( ActorResults );
 		}
 	}
 
 	// Reset this in case Archive is called repeatedly
-	ReferencedObjectList.Empty( );
+	ResetArchive( );
+}
+
+void FPersistentActorReader::ArchiveDestroyedActors( const UObject *WorldContext )
+{
+	check( WorldContext != nullptr );
+	check( !IsArchiving( ) );
 
+	Manager = UPersistenceManager::GetSubsystem( WorldContext );
+
+	ReadHeader( );
+
+	if (Version < EPersistenceVersion::SectionTable)
+	{
+		// No section table to find it with, so skip over all the object data to get to the sections at the end
+		*this << ReferencedObjectList;
+
+		for (int32 Idx = 0; Idx < ReferencedObjectList.Num( ); ++Idx)
+		{
+			int64 BlockSize = 0;
+			*this << BlockSize;
+
+			Seek( Tell( ) + BlockSize );
+		}
+
+		ReadLegacySections( );
+	}
+	else if (const auto Section = FindSection( ESectionID::DestroyedActors ))
+	{
+		Seek( Section->Offset );
+		SerializeDestroyedActors( );
+	}
+
+	ResetArchive( );
+}
+
+void FPersistentActorReader::ReadHeader( void )
+{
+	*this << Version;
+
+	SectionTable.Reset( );
+
+	if (Version >= EPersistenceVersion::SectionTable)
+	{
+		int64 SectionTableOffset = 0;
+		*this << SectionTableOffset;
+
+		const int64 HeaderEnd = Tell( );
+
+		Seek( SectionTableOffset );
+		*this << SectionTable;
+
+		Seek( HeaderEnd );
+	}
+}
+
+void FPersistentActorReader::ReadLegacySections( void )
+{
+	// Before the section table, sections were written sequentially after the object data with their ID & size inline
 	while (!AtEnd( ))
 	{
 		ESectionID SectionID;
@@ -609,19 +873,21 @@ void FPersistentActorReader::Archive( const UObject *WorldContext )
 				break;
 		}
 	}
+}
 
-	for (const FPersistentObjectRecord& Entry : ReferencedObjectList)
-	{
-		if (const auto Actor = Cast< AActor >( Entry.Object ))
-		{
-			if (const auto Component = Actor->GetComponentByClass< UPersistenceComponent >())
-				Component->OnPostArchive.Broadcast( ActorResults );
-		}
-		else if (const auto Interface = Cast< IPersistentSubsystem >( Entry.Object ))
-		{
-			Interface->PostArchiveLoad( ActorResults );
-		}
-	}
+void FPersistentActorReader::ResetArchive( void )
+{
+	ReferencedObjectList.Empty( );
+	SectionTable.Empty( );
+	PersistentSubsystems.Empty( );
+	ActorResults.Empty( );
+	ActorTransforms.Empty( );
+	PhaseIndex = 0;
+
+#if !UE_BUILD_SHIPPING
+	DebuggingLookup.Empty( );
+	SizeBuckets.Empty( );
+#endif
 }
 
 FArchive& FPersistentActorReader::operator<<( UObject *&Res )
@@ -646,6 +912,21 @@ FArchive& FPersistentActorReader::operator<<( UObject *&Res )
 	return *this;
 }
 
+void FPersistentActorReader::AddReferencedObjects( FReferenceCollector &Collector )
+{
+	// Objects created by a time-sliced restore may not be referenced by anything else until they're finalized
+	for (FPersistentObjectRecord &Entry : ReferencedObjectList)
+	{
+		Collector.AddReferencedObject( Entry.Object );
+		Collector.AddReferencedObjects( Entry.Subobjects );
+	}
+}
+
+FString FPersistentActorReader::GetReferencerName( ) const
+{
+	return TEXT( "FPersistentActorReader" );
+}
+
 void FPersistentActorReader::SerializeDestroyedActors( )
 {
 	*this << Manager->DestroyedActors;
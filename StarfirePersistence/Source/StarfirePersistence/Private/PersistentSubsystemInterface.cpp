@@ -1,4 +1,96 @@
 
 #include "PersistentSubsystemInterface.h"
 
-#include UE_INLINE_GENERATED_CPP_BY_NAME(PersistentSubsystemInterface)
\ No newline at end of file
+// Engine
+#include "Engine/World.h"
+#include "Subsystems/Subsystem.h"
+#include "Subsystems/WorldSubsystem.h"
+
+// Core UObject
+#include "UObject/UObjectIterator.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(PersistentSubsystemInterface)
+
+namespace PersistentSubsystemRegistry
+{
+	// All the subsystems (for any world) that have registered themselves as needing to be archived
+	static TArray< TWeakObjectPtr< USubsystem > > RegisteredSubsystems;
+
+#if !UE_BUILD_SHIPPING
+	// World subsystem types that implement the interface but haven't been seen registered yet
+	static TArray< TObjectKey< UClass > > UncheckedTypes;
+
+	// Make sure implementers register themselves since they'd otherwise be silently dropped from archives
+	// Each type is only checked until an instance of it is found, so this is only a handful of lookups per archive
+	static void CheckRegistrations( const UWorld *World )
+	{
+		static bool bFoundTypes = false;
+		if (!bFoundTypes)
+		{
+			bFoundTypes = true;
+			for (TObjectIterator< UClass > It; It; ++It)
+			{
+				if (It->IsChildOf< UWorldSubsystem >( ) && !It->HasAnyClassFlags( CLASS_Abstract ) && It->ImplementsInterface( UPersistentSubsystem::StaticClass( ) ))
+					UncheckedTypes.Push( *It );
+			}
+		}
+
+		if (World == nullptr)
+			return;
+
+		UncheckedTypes.RemoveAll( [ World ]( const TObjectKey< UClass > &Key ) -> bool
+		{
+			const auto Type = Key.ResolveObjectPtr( );
+			if (Type == nullptr)
+				return true;
+
+			const auto Subsystem = World->GetSubsystemBase( Type );
+			if (Subsystem == nullptr)
+				return false;
+
+			ensureAlwaysMsgf( RegisteredSubsystems.Contains( Subsystem ), TEXT( "Subsystem \"%s\" implements IPersistentSubsystem but hasn't called RegisterPersistentSubsystem from Initialize" ), *Subsystem->GetName( ) );
+			return true;
+		} );
+	}
+#endif
+}
+
+void IPersistentSubsystem::RegisterPersistentSubsystem( USubsystem *Subsystem )
+{
+	check( IsInGameThread( ) );
+	check( Subsystem != nullptr );
+	ensureAlwaysMsgf( Subsystem->Implements< UPersistentSubsystem >( ), TEXT( "Subsystem \"%s\" registered as persistent without implementing IPersistentSubsystem" ), *Subsystem->GetName( ) );
+
+	PersistentSubsystemRegistry::RegisteredSubsystems.AddUnique( Subsystem );
+}
+
+void IPersistentSubsystem::UnregisterPersistentSubsystem( USubsystem *Subsystem )
+{
+	check( IsInGameThread( ) );
+
+	PersistentSubsystemRegistry::RegisteredSubsystems.RemoveAll( [ Subsystem ]( const TWeakObjectPtr< USubsystem > &Registered ) -> bool
+	{
+		return !Registered.IsValid( ) || (Registered.Get( ) == Subsystem);
+	} );
+}
+
+void IPersistentSubsystem::GetPersistentSubsystems( const UWorld *World, TArray< USubsystem* > &OutSubsystems )
+{
+	check( IsInGameThread( ) );
+
+	for (const auto &Registered : PersistentSubsystemRegistry::RegisteredSubsystems)
+	{
+		const auto Subsystem = Registered.Get( );
+		if (Subsystem == nullptr)
+			continue;
+
+		if (Subsystem->GetWorld( ) != World)
+			continue;
+
+		OutSubsystems.Push( Subsystem );
+	}
+
+#if !UE_BUILD_SHIPPING
+	PersistentSubsystemRegistry::CheckRegistrations( World );
+#endif
+}
@@ -21,6 +21,7 @@ public:
 
 	// Actor Component API
 	void InitializeComponent( ) override;
+	void BeginPlay( ) override;
 	void EndPlay( const EEndPlayReason::Type EndPlayReason ) override;
 	void UninitializeComponent( ) override;
 
@@ -38,7 +38,17 @@ protected:
 
 	// Internal management of actor tracking
 	void AddSpawnedActor( AActor *Actor, const FGuid &ID );
-	void RemoveSpawnedActor( const FGuid &ID );
+	void RemoveSpawnedActor( AActor *Actor, const FGuid &ID );
+	void AddLevelActor( AActor *Actor, const FGuid &ID );
+	void RemoveLevelActor( AActor *Actor, const FGuid &ID );
+	// Check if a level actor that is beginning play was destroyed in a previous session and should be destroyed again
+	[[nodiscard]] bool ShouldDestroyLevelActor( const AActor *Actor, const FGuid &ID ) const;
+	// Check if an actor was placed in a streaming level (as opposed to the persistent level)
+	[[nodiscard]] static bool IsStreamingLevelActor( const AActor *Actor );
+
+	// Internal management of the per-level index of persistent actors
+	void IndexActor( AActor *Actor, const FGuid &ID );
+	void UnindexActor( const AActor *Actor, const FGuid &ID );
 
 	// Hooks into the level loading process
 	void OnLevelVisible( UWorld *World, const ULevelStreaming *StreamingLevel, ULevel *LoadedLevel );
@@ -50,4 +60,7 @@ protected:
 	// The collection of all known persistent actors
 	UPROPERTY( )
 	TMap< FGuid, TObjectPtr< AActor > > PersistentActors;
+
+	// The persistent actors that have registered from each level, so that level visibility changes don't have to search the whole level
+	TMap< TObjectKey< ULevel >, TMap< FGuid, TWeakObjectPtr< AActor > > > LevelActors;
 };
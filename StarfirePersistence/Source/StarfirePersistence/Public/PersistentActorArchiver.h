@@ -2,11 +2,17 @@
 #pragma once
 
 #include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "UObject/GCObject.h"
+
+#include "PersistenceShared.h"
 
 class UPersistenceComponent;
 class UPersistenceManager;
 class UStarfirePersistenceSettings;
 
+enum class ESectionID : uint32;
+enum class EPersistenceVersion : uint32;
+
 // A shared base for archivers dealing with Persistent Actors & Subsystems
 class FPersistentActorArchiver : public FObjectAndNameAsStringProxyArchive
 {
@@ -62,6 +68,34 @@ protected:
 
 	// A collection of the objects to serialize to or create from the provided archive
 	TArray< FPersistentObjectRecord > ReferencedObjectList;
+
+	// Location information for a section of data in the archive
+	struct FSectionRecord
+	{
+		// The type of data in the section
+		ESectionID ID = { };
+
+		// The position of the section data in the archive
+		int64 Offset = 0;
+
+		// The number of bytes of section data
+		int64 Size = 0;
+
+		friend FArchive& operator<<( FArchive &Ar, FSectionRecord &R )
+		{
+			Ar << R.ID;
+			Ar << R.Offset;
+			Ar << R.Size;
+
+			return Ar;
+		}
+	};
+
+	// The sections of data in the archive, so that they can be seeked to directly (or skipped) without reading the data before them
+	TArray< FSectionRecord > SectionTable;
+
+	// Get the table information for a specific section (if the archive has that section)
+	[[nodiscard]] const FSectionRecord* FindSection( ESectionID ID ) const;
 };
 
 // Archiver that can serialize all (or some set) of actors into an archive
@@ -83,6 +117,10 @@ public:
 	// Function should return true if the object should be included in the archive
 	TFunction< bool (const UObject*) > SubObjectFilter;
 
+	// Whether the sub-objects of each top level object can be collected on worker threads (defaults to the Persistence settings)
+	// When enabled, ComponentFilter and SubObjectFilter may be called from any thread
+	bool bParallelCollection = false;
+
 	// Archive all Actors with a PersistenceComponent & all Subsystem implementing the PersistentSubsystem interface
 	void Archive( const UObject* WorldContext );
 	// Archive a specific set of Objects
@@ -101,12 +139,41 @@ private:
 	// Wrapper to check components for inclusion in the Archive
 	[[nodiscard]] bool ShouldIncludeComponent( const UActorComponent* Component ) const;
 
-	// Add objects to the ReferencedObjectList based on Target, and then recursively treat those objects as Target
-	void RecursiveCollectObjects( UObject* Target, const UPersistenceComponent* Component, int32 CurrentDepth );
+	// The objects found in the hierarchy of a single top level object
+	struct FCollectedHierarchy
+	{
+		// Records for the objects in the hierarchy. OuterIndex is an index into this array, or INDEX_NONE for the top level object
+		TArray< FPersistentObjectRecord > Records;
+
+		// Lookup table of the objects that have been added to the Records and where they are in the array
+		TMap< UObject*, int32 > ObjectToRecordIndexMap;
+	};
+
+	// Write the header information that comes before any sections
+	void WriteHeader( void );
+	// Write the section table at the end of the archive & record its location in the header
+	void WriteSectionTable( void );
+
+	// Record the location of a section of data as it is written to the archive
+	void BeginSection( ESectionID ID );
+	void EndSection( void );
+
+	// Write the Objects and their hierarchies into the archive
+	void ArchiveObjects( const TArray< UObject* > &Objects );
+
+	// The position in the header that the section table location is written to
+	int64 SectionTableOffsetLocation = 0;
+
+	// Add objects to the Hierarchy based on Target, and then recursively treat those objects as Target
+	// Only reads shared writer state, so separate hierarchies can be collected concurrently
+	void RecursiveCollectObjects( UObject* Target, int32 TargetIndex, FCollectedHierarchy &Hierarchy, int32 CurrentDepth ) const;
 
 	// Lookup table of the objects that have been added to the List and where they are in the array
 	TMap< UObject*, int32 > ObjectToReferenceIndexMap;
 
+	// The objects being archived directly, which shouldn't also be collected as part of another object's hierarchy
+	TSet< const UObject* > TopLevelObjects;
+
 	// Cached reference to the config settings for data persistence
 	const UStarfirePersistenceSettings *Settings;
 
@@ -115,7 +182,7 @@ private:
 };
 
 // Archiver that can deserializer actors from an archive
-class STARFIREPERSISTENCE_API FPersistentActorReader : public FPersistentActorArchiver
+class STARFIREPERSISTENCE_API FPersistentActorReader : public FPersistentActorArchiver, public FGCObject
 {
 public:
 	explicit FPersistentActorReader( FArchive &InInnerArchive );
@@ -123,13 +190,92 @@ public:
 	// Use the Archive to restore Actor/Object/Subsystem state
 	void Archive( const UObject* WorldContext );
 
+	// Use the Archive to restore only the destroyed actor tracking, without restoring any objects
+	void ArchiveDestroyedActors( const UObject* WorldContext );
+
+	// Start a time-sliced restore of Actor/Object/Subsystem state from the Archive
+	// TickArchive must then be called (once per frame) until it reports completion. The Reader and the inner archive must be kept alive until then
+	void BeginArchive( const UObject* WorldContext );
+	// Continue a time-sliced restore, doing as much of the spawn/serialize/finish work as fits in the time budget
+	// MaxTimePerFrame_s <= 0.0 uses the budget from the Starfire Persistence settings
+	// Returns true once the restore is complete
+	bool TickArchive( double MaxTimePerFrame_s = 0.0 );
+
+	// Whether a restore has been started and not yet completed
+	[[nodiscard]] bool IsArchiving( ) const { return (Phase != EReadPhase::None) && (Phase != EReadPhase::Complete); }
+	// How far along the restore is, in the range [0, 1]
+	[[nodiscard]] float GetProgress( ) const;
+
 	// FArchive API
 	FArchive& operator<<( UObject*& Res ) override;
 
+	// GC Object API
+	void AddReferencedObjects( FReferenceCollector &Collector ) override;
+	FString GetReferencerName( ) const override;
+
 private:
+	// The passes over the ReferencedObjectList, done separately so that references between objects resolve properly
+	enum class EReadPhase : uint8
+	{
+		None,		// nothing has been read yet
+		Construct,	// spawn, create or find the object for each entry
+		Serialize,	// read the property data into each object
+		Finalize,	// finish spawning actors, register components, notify subsystems
+		Complete,	// everything has been restored
+	};
+
+	// Process entries in the current phase (and move on to later phases) until EndTime has passed
+	void StepArchive( double EndTime );
+
+	// The work for a single entry in each of the phases
+	void ConstructEntry( FPersistentObjectRecord &Entry );
+	void SerializeEntry( const FPersistentObjectRecord &Entry );
+	void FinalizeEntry( const FPersistentObjectRecord &Entry );
+
+	// Read the trailing sections and notify everything that the restore is done
+	void FinishArchive( void );
+
+	// Clear the state from a restore so that the reader could be used again
+	void ResetArchive( void );
+
+	// Read the version & section table information
+	void ReadHeader( void );
+
+	// Read sections from an archive that was written before the section table existed
+	void ReadLegacySections( void );
+
+	// The version of the data being read
+	EPersistenceVersion Version = { };
+
 	// Cached reference to the config settings for data persistence
 	UPersistenceManager *Manager = nullptr;
 
+	// The world that is being restored into
+	TWeakObjectPtr< UWorld > World;
+
+	// Mapping of all the subsystems that are persistent
+	TMap< UClass*, USubsystem* > PersistentSubsystems;
+
+	// The changes made to actors, reported to everything once the restore is complete
+	TArray< FArchivedActor > ActorResults;
+
+	// The transforms read for each actor, applied once the actors are finalized
+	TMap< UObject*, FTransform > ActorTransforms;
+
+	// The pass that the restore is currently working on
+	EReadPhase Phase = EReadPhase::None;
+
+	// The next entry of the ReferencedObjectList to process in the current phase
+	int32 PhaseIndex = 0;
+
+#if !UE_BUILD_SHIPPING
+	// A helpful debugging view of the serialized objects bucketed by type
+	TMap< const UClass*, TArray< UObject* > > DebuggingLookup;
+	// Debugging view of the serialized sizes (uncompressed) of the objects in the save
+	// Size key is the lower bound log10 of the BlockSize ([0:9] -> 1, [10:99] -> 10, [100:999] -> 100, etc)
+	TMap< int, TMap< TSoftClassPtr< UObject >, TArray< int > > > SizeBuckets;
+#endif
+
 	// Read data for destroyed actors from the archive data
    	void SerializeDestroyedActors( void );
-};
\ No newline at end of file
+};
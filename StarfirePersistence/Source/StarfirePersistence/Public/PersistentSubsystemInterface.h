@@ -6,6 +6,7 @@
 #include "PersistentSubsystemInterface.generated.h"
 
 struct FArchivedActor;
+class USubsystem;
 
 // Static type identifying subsystems that are persisted through PersistentActorArchiver
 UINTERFACE( MinimalAPI, meta = (CannotImplementInterfaceInBlueprint) )
@@ -27,4 +28,12 @@ public:
 	
 	// Hook for the subsystem to respond to the completion of the loading process (somewhat analogous to BeginPlay or OnRegisterComponent)
 	virtual void PostArchiveLoad( const TArray< FArchivedActor >& ActorChanges ) {  }
+
+	// Add a subsystem to the collection that is included in archiving, should be called from the subsystem's Initialize
+	static void RegisterPersistentSubsystem( USubsystem *Subsystem );
+	// Remove a subsystem from the collection that is included in archiving, should be called from the subsystem's Deinitialize
+	static void UnregisterPersistentSubsystem( USubsystem *Subsystem );
+
+	// Get the registered persistent subsystems that belong to a specific world
+	static void GetPersistentSubsystems( const UWorld *World, TArray< USubsystem* > &OutSubsystems );
 };
\ No newline at end of file
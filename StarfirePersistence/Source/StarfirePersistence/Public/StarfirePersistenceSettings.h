@@ -22,4 +22,13 @@ public:
 	FText GetSectionText( ) const override;
 	FText GetSectionDescription( ) const override;
 #endif
+
+	// The default amount of time each frame that a time-sliced Persistent Actor Reader may spend restoring objects
+	UPROPERTY( Config, EditDefaultsOnly, meta = (Units = "s", ClampMin = 0.0) )
+	double TimeSlicedRestoreBudget_s = 0.005;
+
+	// Whether Persistent Actor Writers collect the sub-objects of the archived objects on worker threads
+	// Only enable once any ComponentFilter, SubObjectFilter (and IsEditorOnly implementations) are safe to call from any thread
+	UPROPERTY( Config, EditDefaultsOnly )
+	bool bParallelObjectCollection = false;
 };
\ No newline at end of file
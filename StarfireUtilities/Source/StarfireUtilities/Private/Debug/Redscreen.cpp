@@ -31,7 +31,10 @@ void RedscreenImpl( const UObject *WorldContext, bool bOnce, const char *File, i
 	const auto RedscreenManager = URedscreenManager::GetSubsystem( WorldContext );
 	if (RedscreenManager == nullptr)
 		return;
-	
+
+	if (RedscreenManager->ShouldThrottle( File, Line, bOnce ))
+		return;
+
 	int32 BufferSize = STARTING_BUFFER_SIZE;
 	TCHAR StartingBuffer[ STARTING_BUFFER_SIZE ];
 	TCHAR *Buffer = StartingBuffer;
@@ -12,6 +12,7 @@
 
 // Engine
 #include "Engine/Engine.h"
+#include "Engine/World.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(RedscreenManager)
 
@@ -39,16 +40,7 @@ void URedscreenManager::OnMatchStarted( const UObject *WorldContext )
 		
 		ScreenWidget->OnClose.AddDynamic( this, &URedscreenManager::OnScreenClosed );
 
-		if (!QueuedMessages.IsEmpty( ))
-		{
-			bVisible = true;
-			ScreenWidget->AddToViewport( INT_MAX );
-			ScreenWidget->SetVisibility( ESlateVisibility::HitTestInvisible );
-
-			for (const auto &M : QueuedMessages)
-				ScreenWidget->AddMessage( M );
-			QueuedMessages.Empty( );
-		}
+		FlushMessages( );
 	}
 	else
 	{
@@ -66,8 +58,12 @@ void URedscreenManager::Initialize( FSubsystemCollectionBase &Collection )
 		const FString SettingsDefault = PluginFolder / TEXT( "Config/Redscreens.ini" );
 		if (FPaths::FileExists( SettingsDefault ))
 		{
+			const auto Section = TEXT("/Script/StarfireUtilities.RedscreenManager");
+
 			GConfig->LoadFile( SettingsDefault );
-			const FString Path = GConfig->GetStr( TEXT("/Script/StarfireUtilities.RedscreenManager"), TEXT("RedscreenWidgetType"), SettingsDefault );
+			const FString Path = GConfig->GetStr( Section, TEXT("RedscreenWidgetType"), SettingsDefault );
+			GConfig->GetFloat( Section, TEXT("MinRepeatInterval_s"), MinRepeatInterval_s, SettingsDefault );
+			GConfig->GetInt( Section, TEXT("MaxPendingMessages"), MaxPendingMessages, SettingsDefault );
 			GConfig->UnloadFile( SettingsDefault );
 
 			if (!Path.IsEmpty( ))
@@ -78,6 +74,12 @@ void URedscreenManager::Initialize( FSubsystemCollectionBase &Collection )
 
 void URedscreenManager::Deinitialize( )
 {
+	if (TickerHandle.IsValid( ))
+	{
+		FTSTicker::GetCoreTicker( ).RemoveTicker( TickerHandle );
+		TickerHandle.Reset( );
+	}
+
 	ScreenWidget = nullptr;
 
 	Super::Deinitialize( );
@@ -89,33 +91,135 @@ void URedscreenManager::OnScreenClosed( URedscreenScreen *Screen )
 	bVisible = false;
 }
 
-void URedscreenManager::AddRedscreen( const FString &Message, bool bOnce )
+void URedscreenManager::FlushMessages( void )
 {
-	if (bOnce)
+	if ((ScreenWidget == nullptr) || PendingMessages.IsEmpty( ))
+		return;
+
+	if (!bVisible)
 	{
-		const auto CRC = FCrc::StrCrc32( *Message );
-		if (SeenOnceCRCs.Contains( CRC ))
-			return;
+		bVisible = true;
+		ScreenWidget->AddToViewport( INT_MAX / 2 );
+		ScreenWidget->SetVisibility( ESlateVisibility::HitTestInvisible );
+	}
 
-		SeenOnceCRCs.Add( CRC );
+	if (DroppedMessages > 0)
+	{
+		ScreenWidget->AddMessage( FString::Printf( TEXT( "%d earlier redscreens were dropped (see log)" ), DroppedMessages ) );
+		DroppedMessages = 0;
 	}
-	
+
+	while (!PendingMessages.IsEmpty( ))
+		ScreenWidget->AddMessage( PendingMessages.PopFrontValue( ) );
+}
+
+void URedscreenManager::QueueMessage( const FString &Message )
+{
+	if (PendingMessages.Num( ) >= FMath::Max( MaxPendingMessages, 1 ))
+	{
+		PendingMessages.PopFront( );
+		++DroppedMessages;
+	}
+
+	PendingMessages.Add( Message );
+
+	ScheduleTick( );
+}
+
+void URedscreenManager::ReportRepeats( FRedscreenSource &Source, double Now )
+{
+	if (!Source.bOnce)
+	{
+		const FString Message = FString::Printf( TEXT( "(%s, %d): repeated %d more times" ), *FPaths::GetCleanFilename( Source.File ), Source.Line, Source.RepeatCount );
+
+		UE_LOGFMT( LogRedscreen, Warning, "{0}", Message );
+
 #if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
-	if (ScreenWidget != nullptr)
+		QueueMessage( Message );
+#endif
+	}
+
+	// The report counts as being shown so a source that keeps reporting is limited to one report per interval
+	Source.LastTime_s = Now;
+	Source.RepeatCount = 0;
+}
+
+void URedscreenManager::ScheduleTick( void )
+{
+	if (!TickerHandle.IsValid( ))
+		TickerHandle = FTSTicker::GetCoreTicker( ).AddTicker( FTickerDelegate::CreateUObject( this, &URedscreenManager::OnTick ) );
+}
+
+bool URedscreenManager::OnTick( float DeltaTime )
+{
+	const double Now = FPlatformTime::Seconds( );
+
+	// Report repeats once the source has been quiet long enough, otherwise the end of a burst would never be shown
+	bool bRepeating = false;
+	for (auto &[ SourceKey, Source ] : Sources)
+	{
+		if (Source.RepeatCount == 0)
+			continue;
+
+		if ((Now - Source.LastTime_s) >= MinRepeatInterval_s)
+			ReportRepeats( Source, Now );
+		else
+			bRepeating = true;
+	}
+
+	// Batch everything reported since the last tick into a single update of the screen
+	FlushMessages( );
+
+	if (!bRepeating)
+		TickerHandle.Reset( );
+
+	return bRepeating;
+}
+
+bool URedscreenManager::ShouldThrottle( const char *File, int Line, bool bOnce )
+{
+	// Identify the source by the call site, which can be done without having to format the message first
+	const uint32 SourceKey = HashCombineFast( PointerHash( File ), ::GetTypeHash( Line ) );
+
+	auto &Source = Sources.FindOrAdd( SourceKey );
+	const double Now = FPlatformTime::Seconds( );
+
+	if ((Source.LastTime_s > 0.0) && ((Now - Source.LastTime_s) < MinRepeatInterval_s))
 	{
-		if (!bVisible)
+		if (Source.RepeatCount++ == 0)
 		{
-			bVisible = true;
-			ScreenWidget->AddToViewport( INT_MAX / 2 );
-			ScreenWidget->SetVisibility( ESlateVisibility::HitTestInvisible );
+			Source.File = File;
+			Source.Line = Line;
+			Source.bOnce = bOnce;
+
+			ScheduleTick( );
 		}
 
-		ScreenWidget->AddMessage( Message );
+		return true;
 	}
-	else
+
+	// A burst that ended without the ticker getting to it yet, it needs to be reported before the redscreen that follows it
+	if (Source.RepeatCount > 0)
+		ReportRepeats( Source, Now );
+
+	Source.LastTime_s = Now;
+
+	return false;
+}
+
+void URedscreenManager::AddRedscreen( const FString &Message, bool bOnce )
+{
+	if (bOnce)
 	{
-		QueuedMessages.Push( Message );
+		const auto CRC = FCrc::StrCrc32( *Message );
+		if (SeenOnceCRCs.Contains( CRC ))
+			return;
+
+		SeenOnceCRCs.Add( CRC );
 	}
+
+#if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
+	QueueMessage( Message );
 #endif
 
 	UE_LOGFMT( LogRedscreen, Warning, "{0}", Message );
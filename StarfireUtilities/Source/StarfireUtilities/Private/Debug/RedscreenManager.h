@@ -1,6 +1,8 @@
 
 #pragma once
 
+#include "Containers/RingBuffer.h"
+#include "Containers/Ticker.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "Templates/SubsystemNativeAccessors.h"
 
@@ -14,6 +16,11 @@ class URedscreenManager final : public UWorldSubsystem, public TSubsystemNativeA
 {
 	GENERATED_BODY( )
 public:
+	// Check if a redscreen from a specific source (file & line) should be skipped because that source is reporting too often
+	// This happens before the message is formatted so that repeated redscreens are as cheap as possible, skipped redscreens
+	// are only counted and reported together once the source is shown again or has been quiet for MinRepeatInterval_s
+	[[nodiscard]] bool ShouldThrottle( const char *File, int Line, bool bOnce );
+
 	// Add a message to the redscreen UI (possibly creating a screen if one is not active)
 	void AddRedscreen( const FString &Message, bool bOnce );
 
@@ -35,15 +42,61 @@ protected:
 	UPROPERTY( )
 	TObjectPtr<URedscreenScreen> ScreenWidget = nullptr;
 
+	// The minimum amount of time between redscreens shown from the same source, redscreens in between are counted instead of shown
+	UPROPERTY( Config )
+	float MinRepeatInterval_s = 1.0f;
+
+	// The maximum number of messages waiting to be shown, older messages are dropped when there are too many
+	UPROPERTY( Config )
+	int MaxPendingMessages = 32;
+
 	// A hook to be notified when the screen widget is closed (removed from the view)
 	UFUNCTION( )
 	void OnScreenClosed( URedscreenScreen *Screen );
 
+	// Move the pending messages to the screen widget
+	void FlushMessages( void );
+
+	// Add a message to be shown the next time the screen widget is available
+	void QueueMessage( const FString &Message );
+
+	// Make sure the ticker is running to flush messages and report the end of repeated redscreens
+	void ScheduleTick( void );
+
+	// Ticker callback, returns whether the ticker is still needed
+	bool OnTick( float DeltaTime );
+
 	// Whether or not the screen is currently visible
 	bool bVisible = false;
 
-	// Messages that should be shown the next time a redscreen manager is available
-	TArray< FString > QueuedMessages;
+	// Core ticker used instead of world timers so that redscreens are still shown while the game is paused
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	// Messages that should be shown the next time the screen widget is available
+	TRingBuffer< FString > PendingMessages;
+
+	// The number of messages that were dropped from PendingMessages because there were too many
+	int DroppedMessages = 0;
+
+	// Rate limiting information about a single source of redscreens
+	struct FRedscreenSource
+	{
+		// The last time a redscreen from this source was shown
+		double LastTime_s = 0.0;
+		// The number of redscreens throttled since then
+		int RepeatCount = 0;
+		// Where the redscreens come from, for reporting the throttled ones
+		const char *File = nullptr;
+		int Line = 0;
+		// Whether the source only reports unique messages, in which case the throttled ones aren't reported
+		bool bOnce = false;
+	};
+
+	// Report the redscreens that were throttled from a source as a single message
+	void ReportRepeats( FRedscreenSource &Source, double Now );
+
+	// Rate limiting for every source that has reported a redscreen
+	TMap< uint32, FRedscreenSource > Sources;
 
 	// CRCs for the error messages that have been seen so that they're only seen once
 	TSet< uint32 > SeenOnceCRCs;
@@ -8,7 +8,8 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(DevSettingsPreloader)
 
 TArray< TStrongObjectPtr< const UGameInstance > > IDevSettingsPreloader::RefScopes;
-TSet< FSoftObjectPath > IDevSettingsPreloader::PreloadedAssets;
+TMap< FSoftObjectPath, TAsyncLoadPriority > IDevSettingsPreloader::PreloadedAssets;
+TAsyncLoadPriority IDevSettingsPreloader::CurrentPreloaderPriority = 0;
 TSharedPtr< FStreamableHandle > IDevSettingsPreloader::ResourcesHandle;
 
 TSharedPtr< FStreamableHandle > IDevSettingsPreloader::PreloadAll( const UGameInstance *Game )
@@ -27,11 +28,35 @@ TSharedPtr< FStreamableHandle > IDevSettingsPreloader::PreloadAll( const UGameIn
 	{
 		if (const auto Interface = Cast< IDevSettingsPreloader >( *It ))
 		{
+			CurrentPreloaderPriority = Interface->GetPreloadPriority( );
 			Interface->PreloadAll( World );
 		}
 	}
+	CurrentPreloaderPriority = 0;
 
-	ResourcesHandle = UAssetManager::Get( ).GetStreamableManager( ).RequestAsyncLoad( PreloadedAssets.Array( ) );
+	if (PreloadedAssets.IsEmpty( ))
+		return { };
+
+	// Group the assets by priority so that there's one request for each priority instead of one per preloader
+	TMap< TAsyncLoadPriority, TArray< FSoftObjectPath > > PriorityGroups;
+	for (const auto &Entry : PreloadedAssets)
+		PriorityGroups.FindOrAdd( Entry.Value ).Push( Entry.Key );
+
+	PriorityGroups.KeySort( TGreater< TAsyncLoadPriority >( ) );
+
+	auto &StreamableManager = UAssetManager::Get( ).GetStreamableManager( );
+
+	TArray< TSharedPtr< FStreamableHandle > > Handles;
+	for (auto &Group : PriorityGroups)
+	{
+		if (auto Handle = StreamableManager.RequestAsyncLoad( MoveTemp( Group.Value ), FStreamableDelegate( ), Group.Key, false, false, TEXT( "DevSettingsPreload" ) ))
+			Handles.Push( MoveTemp( Handle ) );
+	}
+
+	if (Handles.Num( ) == 1)
+		ResourcesHandle = Handles[ 0 ];
+	else if (!Handles.IsEmpty( ))
+		ResourcesHandle = StreamableManager.CreateCombinedHandle( Handles, TEXT( "DevSettingsPreload" ) );
 
 	return ResourcesHandle;
 }
@@ -56,21 +81,31 @@ TSubclassOf< AGameModeBase > IDevSettingsPreloader::GetPendingGameMode( const UW
 	return Settings->DefaultGameMode;
 }
 
-void IDevSettingsPreloader::Preload( const FSoftObjectPath &SoftPath )
+void IDevSettingsPreloader::Preload( const FSoftObjectPath &SoftPath, TAsyncLoadPriority Priority )
 {
-	PreloadedAssets.Add( SoftPath );
+	if (SoftPath.IsNull( ))
+		return;
+
+	if (Priority == PreloaderPriority)
+		Priority = CurrentPreloaderPriority;
+
+	// Assets requested by multiple preloaders load with the highest of their priorities
+	if (const auto Existing = PreloadedAssets.Find( SoftPath ))
+		*Existing = FMath::Max( *Existing, Priority );
+	else
+		PreloadedAssets.Add( SoftPath, Priority );
 }
 
 template < >
-void IDevSettingsPreloader::Preload( const TArray< TSoftObjectPtr< UObject > > &SoftPaths )
+void IDevSettingsPreloader::Preload( const TArray< TSoftObjectPtr< UObject > > &SoftPaths, TAsyncLoadPriority Priority )
 {
 	for (const auto &Path : SoftPaths)
-		PreloadedAssets.Add( Path.ToSoftObjectPath( ) );
+		Preload( Path.ToSoftObjectPath( ), Priority );
 }
 
 template < >
-void IDevSettingsPreloader::Preload( const TArray< TSoftClassPtr< UObject > > &SoftPaths )
+void IDevSettingsPreloader::Preload( const TArray< TSoftClassPtr< UObject > > &SoftPaths, TAsyncLoadPriority Priority )
 {
 	for (const auto &Path : SoftPaths)
-		PreloadedAssets.Add( Path.ToSoftObjectPath( ) );
+		Preload( Path.ToSoftObjectPath( ), Priority );
 }
\ No newline at end of file
@@ -7,31 +7,31 @@
 #include "Templates/ArrayTypeUtilitiesSF.h"
 
 template < CObjectType type_t >
-void IDevSettingsPreloader::Preload( const TSoftObjectPtr< type_t > &SoftPath )
+void IDevSettingsPreloader::Preload( const TSoftObjectPtr< type_t > &SoftPath, TAsyncLoadPriority Priority )
 {
-	Preload( SoftPath.ToSoftObjectPath( ) );
+	Preload( SoftPath.ToSoftObjectPath( ), Priority );
 }
 
 template < CObjectType type_t >
-void IDevSettingsPreloader::Preload( const TSoftClassPtr< type_t > &SoftPath )
+void IDevSettingsPreloader::Preload( const TSoftClassPtr< type_t > &SoftPath, TAsyncLoadPriority Priority )
 {
-	Preload( SoftPath.ToSoftObjectPath( ) );
+	Preload( SoftPath.ToSoftObjectPath( ), Priority );
 }
 
 template < >
-STARFIREUTILITIES_API void IDevSettingsPreloader::Preload( const TArray< TSoftObjectPtr< UObject > > &SoftPaths );
+STARFIREUTILITIES_API void IDevSettingsPreloader::Preload( const TArray< TSoftObjectPtr< UObject > > &SoftPaths, TAsyncLoadPriority Priority );
 template < >
-STARFIREUTILITIES_API void IDevSettingsPreloader::Preload( const TArray< TSoftClassPtr< UObject > > &SoftPaths );
+STARFIREUTILITIES_API void IDevSettingsPreloader::Preload( const TArray< TSoftClassPtr< UObject > > &SoftPaths, TAsyncLoadPriority Priority );
 
 template < CObjectType type_t >
-void IDevSettingsPreloader::Preload( const TArray< TSoftObjectPtr< type_t > > &SoftPaths )
+void IDevSettingsPreloader::Preload( const TArray< TSoftObjectPtr< type_t > > &SoftPaths, TAsyncLoadPriority Priority )
 {
-	Preload( ArrayUpCast< UObject >( SoftPaths ) );
+	Preload( ArrayUpCast< UObject >( SoftPaths ), Priority );
 }
 
 template < CObjectType type_t >
-void IDevSettingsPreloader::Preload( const TArray< TSoftClassPtr< type_t > > &SoftPaths )
+void IDevSettingsPreloader::Preload( const TArray< TSoftClassPtr< type_t > > &SoftPaths, TAsyncLoadPriority Priority )
 {
 	for (const auto &SP : SoftPaths)
-		Preload( SP.ToSoftObjectPath( ) );
+		Preload( SP.ToSoftObjectPath( ), Priority );
 }
\ No newline at end of file
@@ -0,0 +1,40 @@
+
+#include "Misc/LatentAction_Event.h"
+
+FLatentAction_Event::FTriggerPtr FLatentAction_Event::Create( const UObject* WorldContextObject, const FLatentActionInfo &LatentInfo, const OnFinishDelegate &OnFinished )
+{
+	const auto NewTrigger = MakeShared< FTrigger, ESPMode::ThreadSafe >( );
+
+	if (const auto NewAction = CreateAndAddAction< FLatentAction_Event >( WorldContextObject, LatentInfo, NewTrigger ))
+	{
+		NewAction->OnFinished = OnFinished;
+		return NewTrigger;
+	}
+
+	return nullptr;
+}
+
+FSimpleDelegate FLatentAction_Event::MakeSignalDelegate( const FTriggerPtr &Trigger )
+{
+	if (!Trigger.IsValid( ))
+		return { };
+
+	return FSimpleDelegate::CreateSP( Trigger.ToSharedRef( ), &FTrigger::Signal );
+}
+
+FLatentAction_Event::FLatentAction_Event( const FLatentActionInfo &LatentInfo, const FTriggerRef &InTrigger )
+	: FLatentAction_Simple( LatentInfo ), Trigger( InTrigger )
+{
+}
+
+ELatentActionResponse FLatentAction_Event::Update( void )
+{
+	// The latent action manager still updates every action each frame, but this is only an atomic read until signaled
+	if (Trigger->IsSignaled( ))
+	{
+		OnFinished.ExecuteIfBound( );
+		return ELatentActionResponse::TriggerAndFinish;
+	}
+
+	return ELatentActionResponse::None;
+}
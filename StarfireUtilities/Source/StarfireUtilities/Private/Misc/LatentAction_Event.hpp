@@ -0,0 +1,16 @@
+// ReSharper disable once CppMissingIncludeGuard
+#ifndef __LATENT_ACTION_EVENT_IMPLEMENTATION
+	#error You shouldn't be including the latent action implementation directly
+#endif
+
+template < class type_t >
+bool FLatentAction_Event::Create( const UObject* WorldContextObject, const FLatentActionInfo &LatentInfo, TFuture< type_t > &&Future, const OnFinishDelegate &OnFinished )
+{
+	const auto NewTrigger = Create( WorldContextObject, LatentInfo, OnFinished );
+	if (!NewTrigger.IsValid( ))
+		return false;
+
+	Future.Then( [ NewTrigger ]( TFuture< type_t > ) { NewTrigger->Signal( ); } );
+
+	return true;
+}
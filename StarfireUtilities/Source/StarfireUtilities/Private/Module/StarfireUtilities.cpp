@@ -1,6 +1,8 @@
 
 #include "Module/StarfireUtilities.h"
 
+#include "Templates/ActorSingletonAccessor.h"
+
 #define LOCTEXT_NAMESPACE "StarfireUtilities"
 
 void FStarfireUtilities::StartupModule( )
@@ -12,6 +14,8 @@ void FStarfireUtilities::ShutdownModule( )
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+
+	FActorSingletonAccessorsBase::ShutdownRegistry( );
 }
 
 #undef LOCTEXT_NAMESPACE
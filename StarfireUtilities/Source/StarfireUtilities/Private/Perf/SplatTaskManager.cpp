@@ -2,40 +2,256 @@
 #include "Perf/SplatTaskManager.h"
 
 // Core
+#include "Algo/StableSort.h"
+#include "HAL/IConsoleManager.h"
 #include "Logging/StructuredLog.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SplatTaskManager)
 
 DEFINE_LOG_CATEGORY( LogSplatTaskManager );
 
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Tasks" ), STAT_SplatTasks_Tasks, STATGROUP_SplatTasks );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Tasks Stepped" ), STAT_SplatTasks_Stepped, STATGROUP_SplatTasks );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Tasks Starved" ), STAT_SplatTasks_Starved, STATGROUP_SplatTasks );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Steps" ), STAT_SplatTasks_Steps, STATGROUP_SplatTasks );
+DECLARE_DWORD_COUNTER_STAT( TEXT( "Yields" ), STAT_SplatTasks_Yields, STATGROUP_SplatTasks );
+DECLARE_FLOAT_COUNTER_STAT( TEXT( "Time Used (ms)" ), STAT_SplatTasks_TimeUsed, STATGROUP_SplatTasks );
+DECLARE_FLOAT_COUNTER_STAT( TEXT( "Frame Budget (ms)" ), STAT_SplatTasks_FrameBudget, STATGROUP_SplatTasks );
+
+static TAutoConsoleVariable< float > CVar_SplatFrameBudget( TEXT( "Starfire.SplatTasks.FrameBudgetMs" ), 0.0f,
+	TEXT( "The maximum amount of time (in milliseconds) all splat tasks combined may use each frame. <= 0 is unlimited" ) );
+
+static TAutoConsoleVariable< int > CVar_SplatStarvationFrames( TEXT( "Starfire.SplatTasks.StarvationWarningFrames" ), 60,
+	TEXT( "The number of frames in a row a splat task can be starved of frame budget before a warning is logged. <= 0 disables the warning" ) );
+
+// The number of finished tasks to keep telemetry for
+static constexpr int MaxFinishedTaskSnapshots = 16;
+
+// Generations are shared by every manager so that a stale handle, or one from another manager, can't match a reused slot
+static uint32 NextSlotGeneration( void )
+{
+	static uint32 Generation = 0;
+
+	// Skip 0 on wrap around since that's what an invalid handle uses
+	if (++Generation == 0)
+		Generation = 1;
+
+	return Generation;
+}
+
+void FSplatTaskStats::RecordFrame( int Steps, double Time_s, double MaxTimePerFrame_s, bool bYielded )
+{
+	++FramesStepped;
+
+	TotalSteps += Steps;
+	LastFrameSteps = Steps;
+	PeakFrameSteps = FMath::Max( PeakFrameSteps, Steps );
+
+	TotalTime_s += Time_s;
+	LastFrameTime_s = Time_s;
+	PeakFrameTime_s = FMath::Max( PeakFrameTime_s, Time_s );
+
+	if ((MaxTimePerFrame_s > 0.0) && (Time_s > MaxTimePerFrame_s))
+		++OverBudgetFrames;
+
+	if (bYielded)
+		++YieldCount;
+}
+
 void USplatTaskManager::Tick( float DeltaTime )
 {
 	ensure( !IsTemplate( ) );
 
-	for (int idx = Tasks.Num( ) - 1; idx >= 0; --idx)
+	const double FrameStartTime = FPlatformTime::Seconds( );
+	const double FrameBudget_s = GetFrameBudget( );
+	const double FrameEndTime = (FrameBudget_s > 0.0) ? (FrameStartTime + FrameBudget_s) : TNumericLimits< double >::Max( );
+
+	TGuardValue< bool > TickingGuard( bTicking, true );
+
+	// Work from a copy since tasks may be started or removed by the tasks being stepped
+	TArray< FSplatTaskBase*, TInlineAllocator< 16 > > Schedule;
+	for (const auto &Slot : Slots)
 	{
-		const auto T = Tasks[ idx ];
-			
+		if (Slot.Task != nullptr)
+			Schedule.Push( Slot.Task );
+	}
+
+	Algo::StableSort( Schedule, [ ]( const FSplatTaskBase *A, const FSplatTaskBase *B ) -> bool
+	{
+		return GetSchedulingWeight( A ) > GetSchedulingWeight( B );
+	} );
+
+	const int StarvationWarningFrames = CVar_SplatStarvationFrames.GetValueOnGameThread( );
+
+	INC_DWORD_STAT_BY( STAT_SplatTasks_Tasks, Schedule.Num( ) );
+	INC_FLOAT_STAT_BY( STAT_SplatTasks_FrameBudget, FrameBudget_s * 1000.0 );
+
+	bool bAnyStepped = false;
+	for (const auto T : Schedule)
+	{
+		if (T->bRemoved || T->bPaused || !T->ShouldStep( ))
+			continue;
+
+		// Always let something make progress, even if the budget is tiny
+		if (bAnyStepped && (FPlatformTime::Seconds( ) >= FrameEndTime))
+		{
+			++T->FramesWaiting;
+			++T->Stats.FramesStarved;
+			T->Stats.PeakFramesStarved = FMath::Max( T->Stats.PeakFramesStarved, T->FramesWaiting );
+			INC_DWORD_STAT( STAT_SplatTasks_Starved );
+
+			if ((StarvationWarningFrames > 0) && (T->FramesWaiting == StarvationWarningFrames))
+			{
+				UE_LOGFMT( LogSplatTaskManager, Warning, "Splat task {Handle} ({Name}) has been starved of frame budget for {Frames} frames. Budget is {Budget}ms.",
+					T->Handle.ToString( ), T->DebugName, T->FramesWaiting, FrameBudget_s * 1000.0 );
+			}
+			continue;
+		}
+
+		bAnyStepped = true;
+		T->FramesWaiting = 0;
+
 		int Count = 0;
+		ESplatTaskResult Result = ESplatTaskResult::Next;
 		const double StartTime = FPlatformTime::Seconds( );
 
-		while (ShouldStep( T, Count, StartTime ))
+		while (ShouldStep( T, Count, StartTime, FrameEndTime ))
 		{
-			const auto Result = T->StepTask( );
+			SteppingTask = T;
+			Result = T->StepTask( );
+			SteppingTask = nullptr;
+
 			++Count;
 
-			if (Result == ESplatTaskResult::Complete)
+			if (T->bRestartRequested)
 			{
-				Tasks.RemoveAt( idx );
-				delete T;
-				break;
+				T->bRestartRequested = false;
+				RestartTask_Internal( T );
 			}
-			else if (Result == ESplatTaskResult::Yield)
-			{
+
+			if ((Result == ESplatTaskResult::Complete) || (Result == ESplatTaskResult::Yield))
 				break;
-			}
 		}
+
+		const double StepTime_s = FPlatformTime::Seconds( ) - StartTime;
+		const bool bYielded = (Result == ESplatTaskResult::Yield);
+		const bool bCompleted = (Result == ESplatTaskResult::Complete);
+
+		T->Stats.RecordFrame( Count, StepTime_s, T->MaxTimePerFrame_s, bYielded );
+
+		INC_DWORD_STAT( STAT_SplatTasks_Stepped );
+		INC_DWORD_STAT_BY( STAT_SplatTasks_Steps, Count );
+		INC_DWORD_STAT_BY( STAT_SplatTasks_Yields, bYielded ? 1 : 0 );
+		INC_FLOAT_STAT_BY( STAT_SplatTasks_TimeUsed, StepTime_s * 1000.0 );
+
+		// Collection tasks stick around after getting through their data (in case they're restarted), so they finish when they run out of work
+		if ((bCompleted || !T->ShouldStep( )) && (T->Stats.FramesToCompletion == 0))
+		{
+			T->Stats.FramesToCompletion = GFrameCounter - T->Stats.StartFrame + 1;
+
+			UE_LOGFMT( LogSplatTaskManager, Verbose, "Splat task {Handle} ({Name}) finished after {Frames} frames, {Steps} steps and {Time}ms.",
+				T->Handle.ToString( ), T->DebugName, T->Stats.FramesToCompletion, T->Stats.TotalSteps, T->Stats.TotalTime_s * 1000.0 );
+		}
+
+		if (bCompleted && !T->bRemoved)
+			ReleaseTask( T );
 	}
+
+	for (const auto T : PendingDeletes)
+		delete T;
+	PendingDeletes.Reset( );
+}
+
+void USplatTaskManager::SetFrameBudget( double FrameBudget_s )
+{
+	FrameBudgetOverride_s = FrameBudget_s;
+}
+
+double USplatTaskManager::GetFrameBudget( void ) const
+{
+	if (FrameBudgetOverride_s > 0.0)
+		return FrameBudgetOverride_s;
+
+	return CVar_SplatFrameBudget.GetValueOnGameThread( ) / 1000.0;
+}
+
+double USplatTaskManager::GetSchedulingWeight( const FSplatTaskBase *Task )
+{
+	// Waiting increases the weight so that lower priority tasks eventually get their turn
+	return static_cast< double >( Task->Priority ) * (1 + Task->FramesWaiting);
+}
+
+FSplatTaskSnapshot USplatTaskManager::MakeSnapshot( const FSplatTaskBase *Task )
+{
+	FSplatTaskSnapshot Snapshot;
+	Snapshot.Handle = Task->Handle;
+	Snapshot.DebugName = Task->DebugName;
+	Snapshot.Priority = Task->Priority;
+	Snapshot.MaxCountPerFrame = Task->MaxCountPerFrame;
+	Snapshot.MaxTimePerFrame_s = Task->MaxTimePerFrame_s;
+	Snapshot.bPaused = Task->bPaused;
+	Snapshot.Stats = Task->Stats;
+
+	return Snapshot;
+}
+
+void USplatTaskManager::RecordFinishedTask( const FSplatTaskBase *Task )
+{
+	if (FinishedTasks.Num( ) >= MaxFinishedTaskSnapshots)
+		FinishedTasks.RemoveAt( 0 );
+
+	FinishedTasks.Push( MakeSnapshot( Task ) );
+}
+
+void USplatTaskManager::SetTaskName( const FSplatTaskHandle &Handle, FName DebugName )
+{
+	ensureAlways( IsInGameThread( ) );
+
+	if (const auto T = FindTask( Handle ))
+		T->DebugName = DebugName;
+}
+
+void USplatTaskManager::GetTaskSnapshots( TArray< FSplatTaskSnapshot > &OutActive, TArray< FSplatTaskSnapshot > &OutFinished ) const
+{
+	OutActive.Reset( Slots.Num( ) - FreeSlots.Num( ) );
+	for (const auto &Slot : Slots)
+	{
+		if (Slot.Task != nullptr)
+			OutActive.Push( MakeSnapshot( Slot.Task ) );
+	}
+
+	OutFinished = FinishedTasks;
+}
+
+void USplatTaskManager::DumpTaskSnapshots( FOutputDevice &Ar ) const
+{
+	const auto DumpSnapshot = [ &Ar ]( const FSplatTaskSnapshot &Snapshot )
+	{
+		const auto &Stats = Snapshot.Stats;
+		const double AverageSteps = (Stats.FramesStepped > 0) ? (static_cast< double >( Stats.TotalSteps ) / Stats.FramesStepped) : 0.0;
+		const double AverageTime_ms = (Stats.FramesStepped > 0) ? (Stats.TotalTime_s * 1000.0 / Stats.FramesStepped) : 0.0;
+
+		Ar.Logf( TEXT( "  [%s] %s: priority %d, limits %d/frame %.3fms/frame%s" ), *Snapshot.Handle.ToString( ), *Snapshot.DebugName.ToString( ),
+			static_cast< int >( Snapshot.Priority ), Snapshot.MaxCountPerFrame, Snapshot.MaxTimePerFrame_s * 1000.0, Snapshot.bPaused ? TEXT( " (paused)" ) : TEXT( "" ) );
+		Ar.Logf( TEXT( "      steps: %lld total, %d last frame, %.1f avg, %d peak" ), Stats.TotalSteps, Stats.LastFrameSteps, AverageSteps, Stats.PeakFrameSteps );
+		Ar.Logf( TEXT( "      time: %.3fms total, %.3fms last frame, %.3fms avg, %.3fms peak, %d frames over budget" ),
+			Stats.TotalTime_s * 1000.0, Stats.LastFrameTime_s * 1000.0, AverageTime_ms, Stats.PeakFrameTime_s * 1000.0, Stats.OverBudgetFrames );
+		Ar.Logf( TEXT( "      frames: %d stepped, %d starved (%d peak), %d yields, %llu to completion" ),
+			Stats.FramesStepped, Stats.FramesStarved, Stats.PeakFramesStarved, Stats.YieldCount, Stats.FramesToCompletion );
+	};
+
+	Ar.Logf( TEXT( "Splat Tasks for %s (frame budget %.3fms)" ), *GetNameSafe( GetWorld( ) ), GetFrameBudget( ) * 1000.0 );
+
+	Ar.Logf( TEXT( " Active: %d" ), Slots.Num( ) - FreeSlots.Num( ) );
+	for (const auto &Slot : Slots)
+	{
+		if (Slot.Task != nullptr)
+			DumpSnapshot( MakeSnapshot( Slot.Task ) );
+	}
+
+	Ar.Logf( TEXT( " Recently Finished: %d" ), FinishedTasks.Num( ) );
+	for (const auto &Snapshot : FinishedTasks)
+		DumpSnapshot( Snapshot );
 }
 
 void USplatTaskManager::StartTask_Internal( FSplatTaskBase *NewTask )
@@ -43,16 +259,69 @@ void USplatTaskManager::StartTask_Internal( FSplatTaskBase *NewTask )
 	ensureAlways( IsInGameThread( ) );
 	ensureAlways( (NewTask->MaxCountPerFrame > 0) || (NewTask->MaxTimePerFrame_s > 0.0) );
 
-	NewTask->Handle.Handle = FSplatTaskHandle::RollingID++;
+	const int Index = FreeSlots.IsEmpty( ) ? Slots.AddDefaulted( ) : FreeSlots.Pop( );
+	auto &Slot = Slots[ Index ];
+	Slot.Task = NewTask;
+	Slot.Generation = NextSlotGeneration( );
 
-	Tasks.Push( NewTask );
+	NewTask->Handle.Index = Index;
+	NewTask->Handle.Generation = Slot.Generation;
+	NewTask->Stats.StartFrame = GFrameCounter;
 }
 
-bool USplatTaskManager::ShouldStep( const FSplatTaskBase *Task, int Count, double StartTime )
+USplatTaskManager::FSplatTaskBase* USplatTaskManager::FindTask( const FSplatTaskHandle &Handle ) const
 {
+	if (!Handle.IsValid( ) || !Slots.IsValidIndex( Handle.Index ))
+		return nullptr;
+
+	const auto &Slot = Slots[ Handle.Index ];
+	if (Slot.Generation != Handle.Generation)
+		return nullptr;
+
+	return Slot.Task;
+}
+
+void USplatTaskManager::RestartTask_Internal( FSplatTaskBase *Task )
+{
+	Task->Restart( );
+
+	Task->Stats.StartFrame = GFrameCounter;
+	Task->Stats.FramesToCompletion = 0;
+}
+
+void USplatTaskManager::ReleaseTask( FSplatTaskBase *Task )
+{
+	RecordFinishedTask( Task );
+
+	auto &Slot = Slots[ Task->Handle.Index ];
+	check( Slot.Task == Task );
+
+	Slot.Task = nullptr;
+	Slot.Generation = 0;
+
+	FreeSlots.Push( Task->Handle.Index );
+
+	Task->bRemoved = true;
+
+	// The task might be in the middle of a step (or later in the schedule) so it has to stick around until the tick is over
+	if (bTicking)
+		PendingDeletes.Push( Task );
+	else
+		delete Task;
+}
+
+bool USplatTaskManager::ShouldStep( const FSplatTaskBase *Task, int Count, double StartTime, double FrameEndTime )
+{
+	// The task may have done these to itself during its last step
+	if (Task->bRemoved || Task->bPaused)
+		return false;
+
 	if (!Task->ShouldStep( ))
 		return false;
 
+	if ((Count > 0) && (FPlatformTime::Seconds( ) > FrameEndTime))
+		return false;
+
 	if (Task->MaxCountPerFrame > 0)
 	{
 		if (Count >= Task->MaxCountPerFrame)
@@ -72,39 +341,55 @@ void USplatTaskManager::RestartTask( const FSplatTaskHandle &Handle )
 {
 	ensureAlways( IsInGameThread( ) );
 
-	if (!Handle.IsValid( ))
+	const auto T = FindTask( Handle );
+	if (T == nullptr)
 		return;
 
-	for (int idx = Tasks.Num( ) - 1; idx >= 0; --idx)
+	// Restarting in the middle of a step would leave the task in a bad state
+	if (T == SteppingTask)
 	{
-		const auto T = Tasks[ idx ];
-		if (T->Handle == Handle)
-		{
-			T->Restart( );
-			break;
-		}
+		T->bRestartRequested = true;
+		return;
 	}
+
+	RestartTask_Internal( T );
 }
 
 void USplatTaskManager::RemoveTask( FSplatTaskHandle &Handle )
 {
 	ensureAlways( IsInGameThread( ) );
 	
-	if (!Handle.IsValid( ))
-		return;
-	
-	for (int idx = Tasks.Num( ) - 1; idx >= 0; --idx)
-	{
-		const auto T = Tasks[ idx ];
-		if (T->Handle == Handle)
-		{
-			Tasks.RemoveAt( idx );
-			delete T;
-			break;
-		}
-	}
+	if (const auto T = FindTask( Handle ))
+		ReleaseTask( T );
+
+	Handle = { };
+}
+
+void USplatTaskManager::PauseTask( const FSplatTaskHandle &Handle )
+{
+	ensureAlways( IsInGameThread( ) );
+
+	if (const auto T = FindTask( Handle ))
+		T->bPaused = true;
+}
+
+void USplatTaskManager::ResumeTask( const FSplatTaskHandle &Handle )
+{
+	ensureAlways( IsInGameThread( ) );
+
+	if (const auto T = FindTask( Handle ))
+		T->bPaused = false;
+}
 
-	Handle.Handle = 0;
+bool USplatTaskManager::IsTaskValid( const FSplatTaskHandle &Handle ) const
+{
+	return FindTask( Handle ) != nullptr;
+}
+
+bool USplatTaskManager::IsTaskPaused( const FSplatTaskHandle &Handle ) const
+{
+	const auto T = FindTask( Handle );
+	return (T != nullptr) && T->bPaused;
 }
 
 ETickableTickType USplatTaskManager::GetTickableTickType() const
@@ -119,11 +404,12 @@ void USplatTaskManager::Deinitialize( void )
 {
 	UE_LOGFMT( LogSplatTaskManager, Log, "USplatTaskManager::Deinitialize" );
 
-	for (auto T : Tasks)
+	for (const auto &Slot : Slots)
 	{
-		delete T;
+		delete Slot.Task;
 	}
-	Tasks.Empty( );
+	Slots.Empty( );
+	FreeSlots.Empty( );
 
 	Super::Deinitialize( );
 }
@@ -131,4 +417,28 @@ void USplatTaskManager::Deinitialize( void )
 bool USplatTaskManager::DoesSupportWorldType( const EWorldType::Type WorldType ) const
 {
 	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE);
-}
\ No newline at end of file
+}
+//**********************************************************************************************************************
+// Console Commands
+
+#include "Misc/ExecSF.h"
+
+struct FSplatTaskExecs : public FExecSF
+{
+	FSplatTaskExecs( )
+	{
+		AddExec( TEXT( "Starfire.SplatTasks.Dump" ), TEXT( "Output the telemetry for all the active and recently finished splat tasks." ), FExecDelegate::CreateStatic( &FSplatTaskExecs::Dump ) );
+	}
+
+	static void Dump( const UWorld *World, const TCHAR *Cmd, FOutputDevice &Ar )
+	{
+		const auto Manager = USplatTaskManager::GetSubsystem( World );
+		if (Manager == nullptr)
+		{
+			Ar.Log( TEXT( "Starfire.SplatTasks.Dump requires a game world with a splat task manager" ) );
+			return;
+		}
+
+		Manager->DumpTaskSnapshots( Ar );
+	}
+} GSplatTaskExecs;
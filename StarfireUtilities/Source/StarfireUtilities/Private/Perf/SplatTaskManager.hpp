@@ -5,13 +5,14 @@
 #endif
 
 template < class type_t, SplatTaskManager::CallableDataTask< type_t > task_t >
-FSplatTaskHandle USplatTaskManager::StartTask( TArray< type_t > &Data, task_t &&SplatTask, int MaxCountPerFrame, double MaxTimePerFrame_s )
+FSplatTaskHandle USplatTaskManager::StartTask( TArray< type_t > &Data, task_t &&SplatTask, int MaxCountPerFrame, double MaxTimePerFrame_s, ESplatTaskPriority Priority )
 {
 	check( IsInGameThread(  ) );
 
 	auto NewTask = new TSplatTask_Data< type_t, task_t >( Data, MoveTemp( SplatTask ) );
 	NewTask->MaxCountPerFrame = MaxCountPerFrame;
 	NewTask->MaxTimePerFrame_s = MaxTimePerFrame_s;
+	NewTask->Priority = Priority;
 
 	StartTask_Internal( NewTask );
 
@@ -19,19 +20,40 @@ FSplatTaskHandle USplatTaskManager::StartTask( TArray< type_t > &Data, task_t &&
 }
 
 template < SplatTaskManager::CallableTask task_t >
-FSplatTaskHandle USplatTaskManager::StartTask( task_t &&SplatTask, int MaxCountPerFrame, double MaxTimePerFrame_s )
+FSplatTaskHandle USplatTaskManager::StartTask( task_t &&SplatTask, int MaxCountPerFrame, double MaxTimePerFrame_s, ESplatTaskPriority Priority )
 {
 	check( IsInGameThread(  ) );
 
 	auto NewTask = new TSplatTask< task_t >( MoveTemp( SplatTask ) );
 	NewTask->MaxCountPerFrame = MaxCountPerFrame;
 	NewTask->MaxTimePerFrame_s = MaxTimePerFrame_s;
+	NewTask->Priority = Priority;
 
 	StartTask_Internal( NewTask );
 
 	return NewTask->Handle;
 }
 
+template < class type_t, SplatTaskManager::CallableParallelTask< type_t > work_t, SplatTaskManager::CallableFinalizeTask< type_t, SplatTaskManager::TParallelTaskResult< work_t, type_t > > finalize_t >
+FSplatTaskHandle USplatTaskManager::StartParallelTask( TArray< type_t > &Data, work_t &&WorkTask, finalize_t &&FinalizeTask, int MaxCountPerFrame, double MaxTimePerFrame_s, int ChunkSize, ESplatTaskPriority Priority )
+{
+	check( IsInGameThread(  ) );
+	ensureAlways( ChunkSize > 0 );
+
+	using result_t = SplatTaskManager::TParallelTaskResult< work_t, type_t >;
+
+	auto NewTask = new TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >( Data, MoveTemp( WorkTask ), MoveTemp( FinalizeTask ), FMath::Max( ChunkSize, 1 ) );
+	NewTask->MaxCountPerFrame = MaxCountPerFrame;
+	NewTask->MaxTimePerFrame_s = MaxTimePerFrame_s;
+	NewTask->Priority = Priority;
+
+	StartTask_Internal( NewTask );
+
+	NewTask->LaunchChunks( );
+
+	return NewTask->Handle;
+}
+
 template < class task_t >
 USplatTaskManager::TSplatTask< task_t >::TSplatTask( task_t &&T ) : Task( MoveTemp( T ) )
 {
@@ -79,4 +101,103 @@ template < class type_t, class task_t >
 void USplatTaskManager::TSplatTask_Data< type_t, task_t >::Restart( void )
 {
 	CurrentIdx = 0;
-}
\ No newline at end of file
+}
+template < class type_t, class result_t, class work_t, class finalize_t >
+USplatTaskManager::TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >::TSplatTask_ParallelData( TArray< type_t > &D, work_t &&W, finalize_t &&F, int InChunkSize ) :
+	ChunkSize( InChunkSize ), Data( D ), WorkTask( MoveTemp( W ) ), FinalizeTask( MoveTemp( F ) )
+{
+}
+
+template < class type_t, class result_t, class work_t, class finalize_t >
+USplatTaskManager::TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >::~TSplatTask_ParallelData( )
+{
+	// The worker tasks reference this task, so they have to be finished before it can go away
+	CancelChunks( );
+}
+
+template < class type_t, class result_t, class work_t, class finalize_t >
+bool USplatTaskManager::TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >::ShouldStep( void ) const
+{
+	return Results.IsValidIndex( CurrentIdx );
+}
+
+template < class type_t, class result_t, class work_t, class finalize_t >
+ESplatTaskResult USplatTaskManager::TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >::StepTask( void )
+{
+	// Nothing else can be finalized until the worker gets through this chunk
+	if (!ChunkTasks[ CurrentIdx / ChunkSize ].IsCompleted( ))
+		return ESplatTaskResult::Yield;
+
+	const ESplatTaskResult Result = FinalizeTask( Data[ CurrentIdx ], Results[ CurrentIdx ] );
+	if (Result == ESplatTaskResult::Remove)
+		PendingRemovals.Push( CurrentIdx );
+
+	++CurrentIdx;
+
+	if (CurrentIdx == Results.Num( ))
+	{
+		ApplyRemovals( );
+
+		Results.Empty( );
+		ChunkTasks.Empty( );
+	}
+
+	return (Result == ESplatTaskResult::Remove) ? ESplatTaskResult::Next : Result;
+}
+
+template < class type_t, class result_t, class work_t, class finalize_t >
+void USplatTaskManager::TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >::Restart( void )
+{
+	CancelChunks( );
+	ApplyRemovals( );
+
+	LaunchChunks( );
+}
+
+template < class type_t, class result_t, class work_t, class finalize_t >
+void USplatTaskManager::TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >::LaunchChunks( void )
+{
+	CurrentIdx = 0;
+	bCancelled = false;
+
+	Results.Reset( );
+	Results.SetNum( Data.Num( ) );
+
+	ChunkTasks.Reset( );
+	for (int ChunkStart = 0; ChunkStart < Data.Num( ); ChunkStart += ChunkSize)
+	{
+		const int ChunkEnd = FMath::Min( ChunkStart + ChunkSize, Data.Num( ) );
+
+		ChunkTasks.Push( UE::Tasks::Launch( UE_SOURCE_LOCATION, [ this, ChunkStart, ChunkEnd ]( )
+		{
+			for (int idx = ChunkStart; idx < ChunkEnd; ++idx)
+			{
+				if (bCancelled.load( std::memory_order_relaxed ))
+					return;
+
+				const type_t &Element = Data[ idx ];
+				Results[ idx ] = WorkTask( Element );
+			}
+		} ) );
+	}
+}
+
+template < class type_t, class result_t, class work_t, class finalize_t >
+void USplatTaskManager::TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >::CancelChunks( void )
+{
+	bCancelled = true;
+
+	UE::Tasks::Wait( ChunkTasks );
+	ChunkTasks.Empty( );
+}
+
+template < class type_t, class result_t, class work_t, class finalize_t >
+void USplatTaskManager::TSplatTask_ParallelData< type_t, result_t, work_t, finalize_t >::ApplyRemovals( void )
+{
+	// Back to front so that the earlier indices stay valid
+	for (int idx = PendingRemovals.Num( ) - 1; idx >= 0; --idx)
+	{
+		Data.RemoveAt( PendingRemovals[ idx ] );
+	}
+	PendingRemovals.Empty( );
+}
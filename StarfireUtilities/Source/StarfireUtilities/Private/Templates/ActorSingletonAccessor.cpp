@@ -3,6 +3,66 @@
 
 #include "EngineUtils.h"
 
+namespace ActorSingletonRegistry
+{
+	// The singletons of a world, registered under each class of the singleton's hierarchy
+	struct FWorldSingletons
+	{
+		// The singleton for each type that has registered or been found by searching
+		TMap< TObjectKey< UClass >, TWeakObjectPtr< AActor > > Singletons;
+
+		// Types that a search of the world didn't find, so lookups don't search again until something that might be one shows up
+		TSet< TObjectKey< UClass > > Missing;
+
+		// Handle to the callback that clears Missing when actors are spawned in the world
+		FDelegateHandle ActorSpawnedHandle;
+	};
+
+	// The singletons of every world
+	static TMap< TObjectKey< UWorld >, FWorldSingletons > Registry;
+
+	// Handles to the callbacks that keep the registry in sync with the worlds
+	static FDelegateHandle WorldCleanupHandle;
+	static FDelegateHandle LevelAddedHandle;
+
+	static void OnWorldCleanup( UWorld *World, bool bSessionEnded, bool bCleanupResources )
+	{
+		if (const auto Singletons = Registry.Find( World ))
+		{
+			World->RemoveOnActorSpawnedHandler( Singletons->ActorSpawnedHandle );
+			Registry.Remove( World );
+		}
+	}
+
+	static void OnLevelAdded( ULevel *Level, UWorld *World )
+	{
+		// Actors in streamed levels aren't spawned so they have to be considered separately
+		if (const auto Singletons = Registry.Find( World ))
+			Singletons->Missing.Reset( );
+	}
+
+	static FWorldSingletons& GetWorldSingletons( const UWorld *World )
+	{
+		if (!WorldCleanupHandle.IsValid( ))
+		{
+			WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic( &OnWorldCleanup );
+			LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddStatic( &OnLevelAdded );
+		}
+
+		if (const auto Existing = Registry.Find( World ))
+			return *Existing;
+
+		auto &Singletons = Registry.Add( World );
+		Singletons.ActorSpawnedHandle = World->AddOnActorSpawnedHandler( FOnActorSpawned::FDelegate::CreateLambda( [ WorldKey = TObjectKey< UWorld >( World ) ]( AActor* )
+		{
+			if (const auto Spawned = Registry.Find( WorldKey ))
+				Spawned->Missing.Reset( );
+		} ) );
+
+		return Singletons;
+	}
+}
+
 const UWorld * FActorSingletonAccessorsBase::GetWorldFromContext( const UObject *WorldContext )
 {
 	if (!IsValid( WorldContext ))
@@ -16,9 +76,86 @@ AActor* FActorSingletonAccessorsBase::GetActorSingleton( const UWorld *World, co
 	if (!IsValid( World ))
 		return nullptr;
 
+	check( IsInGameThread( ) );
+
+	auto &WorldSingletons = ActorSingletonRegistry::GetWorldSingletons( World );
+	if (WorldSingletons.Missing.Contains( SingletonType.Get( ) ))
+		return nullptr;
+
+	auto &Singleton = WorldSingletons.Singletons.FindOrAdd( SingletonType.Get( ) );
+	if (const auto Actor = Singleton.Get( ); IsValid( Actor ))
+		return Actor;
+
+	// Fallback for singletons that don't register themselves (or haven't begun play yet)
 	const FActorIterator It( World, SingletonType );
-	if (It)
-		return *It;
+	Singleton = It ? *It : nullptr;
+
+	if (Singleton == nullptr)
+		WorldSingletons.Missing.Add( SingletonType.Get( ) );
+
+	return Singleton.Get( );
+}
+
+void FActorSingletonAccessorsBase::RegisterActorSingleton( AActor *Singleton )
+{
+	check( IsInGameThread( ) );
+
+	if (!IsValid( Singleton ))
+		return;
+
+	const auto World = Singleton->GetWorld( );
+	if (World == nullptr)
+		return;
+
+	// Register for the entire hierarchy so that singletons can be found by any of their base types
+	auto &WorldSingletons = ActorSingletonRegistry::GetWorldSingletons( World );
+	for (UClass *Class = Singleton->GetClass( ); (Class != nullptr) && (Class != AActor::StaticClass( )); Class = Class->GetSuperClass( ))
+	{
+		auto &Existing = WorldSingletons.Singletons.FindOrAdd( Class );
+		if (!Existing.IsValid( ))
+			Existing = Singleton;
+
+		WorldSingletons.Missing.Remove( Class );
+	}
+}
+
+void FActorSingletonAccessorsBase::UnregisterActorSingleton( AActor *Singleton )
+{
+	check( IsInGameThread( ) );
+
+	if (Singleton == nullptr)
+		return;
+
+	const auto World = Singleton->GetWorld( );
+	if (World == nullptr)
+		return;
+
+	const auto WorldSingletons = ActorSingletonRegistry::Registry.Find( World );
+	if (WorldSingletons == nullptr)
+		return;
+
+	for (UClass *Class = Singleton->GetClass( ); (Class != nullptr) && (Class != AActor::StaticClass( )); Class = Class->GetSuperClass( ))
+	{
+		const auto Existing = WorldSingletons->Singletons.Find( Class );
+		if ((Existing != nullptr) && (*Existing == Singleton))
+			WorldSingletons->Singletons.Remove( Class );
+	}
+}
+
+void FActorSingletonAccessorsBase::ShutdownRegistry( void )
+{
+	using namespace ActorSingletonRegistry;
+
+	FWorldDelegates::OnWorldCleanup.Remove( WorldCleanupHandle );
+	FWorldDelegates::LevelAddedToWorld.Remove( LevelAddedHandle );
+	WorldCleanupHandle.Reset( );
+	LevelAddedHandle.Reset( );
+
+	for (const auto &Entry : Registry)
+	{
+		if (const auto World = Entry.Key.ResolveObjectPtr( ))
+			World->RemoveOnActorSpawnedHandler( Entry.Value.ActorSpawnedHandle );
+	}
 
-	return nullptr;
+	Registry.Empty( );
 }
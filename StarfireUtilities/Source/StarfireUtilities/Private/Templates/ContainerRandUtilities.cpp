@@ -9,6 +9,7 @@ static void Test( )
 	TSet< float > SetTest;
 
 	ContainerRand::Shuffle( ArrayTest );
+	ContainerRand::PartialShuffle( ArrayTest, 3 );
 
 	// if uncommented, these should fail to compile since they're always sorted
 	//ContainerRand::Shuffle( MapTest );
@@ -25,4 +26,101 @@ static void Test( )
 		const auto Test2 = ContainerRand::RandRemove( MapTest );
 		const auto Test3 = ContainerRand::RandRemove( SetTest );
 	}
+
+	{
+		const auto Test1 = ContainerRand::RandSample( ArrayTest, 3 );
+
+		const ContainerRand::FWeightedSelector Selector( { 1.0f, 2.0f, 0.0f, 5.0f } );
+		const auto Test2 = ArrayTest[ Selector.Select( ) ];
+	}
+}
+
+namespace ContainerRand
+{
+	FWeightedSelector::FWeightedSelector( TConstArrayView< float > Weights )
+	{
+		Build( Weights );
+	}
+
+	void FWeightedSelector::Build( TConstArrayView< float > Weights )
+	{
+		Probabilities.Reset( );
+		Aliases.Reset( );
+
+		double TotalWeight = 0.0;
+		for (const float W : Weights)
+			TotalWeight += FMath::Max( W, 0.0f );
+
+		if (TotalWeight <= 0.0)
+			return;
+
+		const int Count = Weights.Num( );
+		Probabilities.SetNumUninitialized( Count );
+		Aliases.SetNumUninitialized( Count );
+
+		// Scale the weights so that the average is 1, then split them into the columns that are under and over that average
+		TArray< double > Scaled;
+		Scaled.SetNumUninitialized( Count );
+
+		TArray< int > Small, Large;
+		Small.Reserve( Count );
+		Large.Reserve( Count );
+
+		for (int idx = 0; idx < Count; ++idx)
+		{
+			Scaled[ idx ] = FMath::Max( Weights[ idx ], 0.0f ) * Count / TotalWeight;
+
+			if (Scaled[ idx ] < 1.0)
+				Small.Push( idx );
+			else
+				Large.Push( idx );
+		}
+
+		// Fill up each under-full column with part of an over-full one
+		while (!Small.IsEmpty( ) && !Large.IsEmpty( ))
+		{
+			const int Less = Small.Pop( );
+			const int More = Large.Pop( );
+
+			Probabilities[ Less ] = static_cast< float >( Scaled[ Less ] );
+			Aliases[ Less ] = More;
+
+			Scaled[ More ] = (Scaled[ More ] + Scaled[ Less ]) - 1.0;
+			if (Scaled[ More ] < 1.0)
+				Small.Push( More );
+			else
+				Large.Push( More );
+		}
+
+		// Anything left over is full (or only short due to floating point error)
+		for (const int idx : Large)
+		{
+			Probabilities[ idx ] = 1.0f;
+			Aliases[ idx ] = idx;
+		}
+		for (const int idx : Small)
+		{
+			Probabilities[ idx ] = 1.0f;
+			Aliases[ idx ] = idx;
+		}
+	}
+
+	int FWeightedSelector::Select( void ) const
+	{
+		check( !IsEmpty( ) );
+
+		return Select( FMath::RandHelper( Num( ) ), FMath::FRand( ) );
+	}
+
+	int FWeightedSelector::Select( const FRandomStream &Stream ) const
+	{
+		check( !IsEmpty( ) );
+
+		return Select( Stream.RandHelper( Num( ) ), Stream.FRand( ) );
+	}
+
+	int FWeightedSelector::Select( int Column, float Roll ) const
+	{
+		return (Roll < Probabilities[ Column ]) ? Column : Aliases[ Column ];
+	}
 }
\ No newline at end of file
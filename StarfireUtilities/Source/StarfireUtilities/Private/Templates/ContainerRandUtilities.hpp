@@ -18,6 +18,49 @@ namespace ContainerRand
 		}
 	}
 
+	template < class container_t >
+		requires requires( container_t C) { { C.Num( ) } -> std::same_as< int >; C.Swap( int( ), int( ) ); }
+	void PartialShuffle( container_t &Container, int Count )
+	{
+		const int LastIdx = Container.Num( ) - 1;
+		const int StopIdx = FMath::Min( Count, LastIdx );
+		for (int x = 0; x < StopIdx; ++x)
+		{
+			const int RandIdx = FMath::RandRange( x, LastIdx );
+			Container.Swap( x, RandIdx );
+		}
+	}
+
+	template < class type_t >
+	TArray< type_t > RandSample( const TArray< type_t > &Container, int Count )
+	{
+		check( Count <= Container.Num( ) );
+		Count = FMath::Clamp( Count, 0, Container.Num( ) );
+
+		TArray< type_t > Sample;
+		Sample.Reserve( Count );
+
+		// A partial fisher-yates over the indices, where only the swapped indices are tracked instead of copying the whole array
+		TMap< int, int > Swapped;
+		Swapped.Reserve( Count );
+
+		const int LastIdx = Container.Num( ) - 1;
+		for (int x = 0; x < Count; ++x)
+		{
+			const int RandIdx = FMath::RandRange( x, LastIdx );
+
+			const int *AtRand = Swapped.Find( RandIdx );
+			const int *AtCurrent = Swapped.Find( x );
+
+			const int SelectedIdx = (AtRand != nullptr) ? *AtRand : RandIdx;
+			Swapped.Add( RandIdx, (AtCurrent != nullptr) ? *AtCurrent : x );
+
+			Sample.Push( Container[ SelectedIdx ] );
+		}
+
+		return Sample;
+	}
+
 	template < class type_t >
 	auto RandElement( const TArray< type_t > &Container )
 	{
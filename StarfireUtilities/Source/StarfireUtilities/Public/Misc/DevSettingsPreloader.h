@@ -23,39 +23,49 @@ class STARFIREUTILITIES_API IDevSettingsPreloader
 	GENERATED_BODY( )
 public:
 	// Preload any soft references from developer settings that implement this interface
+	// All the references are requested together, with the returned handle completing once all of them have loaded
 	[[nodiscard]] static TSharedPtr< FStreamableHandle > PreloadAll( const UGameInstance *Game );
 	// Allow the references from developer settings to be unloaded
 	static void GameShutdown( const UGameInstance *Game );
 
 protected:
+	// Value for Preload calls to use the priority of the preloader making the call
+	static constexpr TAsyncLoadPriority PreloaderPriority = MIN_int32;
+
 	// Hook to give derived types the chance to request content from their soft references
 	virtual void PreloadAll( const UWorld *World ) = 0;
 
+	// The async loading priority for references preloaded by this preloader, higher values are loaded first
+	[[nodiscard]] virtual TAsyncLoadPriority GetPreloadPriority( void ) const { return 0; }
+
 	// Utility for figuring out the type of game mode that will be created
 	// PreloadAll can be called too early for their to be a game mode instance available yet
 	[[nodiscard]] static TSubclassOf< AGameModeBase > GetPendingGameMode( const UWorld *World );
 
 	// Add an object to be preloaded by soft path
-	static void Preload( const FSoftObjectPath &SoftPath );
+	// Priority overrides the preloader's priority for the object
+	static void Preload( const FSoftObjectPath &SoftPath, TAsyncLoadPriority Priority = PreloaderPriority );
 	
 	// Add an object to be preloaded by soft reference
 	template < CObjectType type_t >
-	static void Preload( const TSoftObjectPtr< type_t > &SoftPath );
+	static void Preload( const TSoftObjectPtr< type_t > &SoftPath, TAsyncLoadPriority Priority = PreloaderPriority );
 	template < CObjectType type_t >
-	static void Preload( const TSoftClassPtr< type_t > &SoftPath );
+	static void Preload( const TSoftClassPtr< type_t > &SoftPath, TAsyncLoadPriority Priority = PreloaderPriority );
 
 	// Add collections of objects to be preloaded by soft references
 	template < CObjectType type_t >
-	static void Preload( const TArray< TSoftObjectPtr< type_t > > &SoftPaths );
+	static void Preload( const TArray< TSoftObjectPtr< type_t > > &SoftPaths, TAsyncLoadPriority Priority = PreloaderPriority );
 	template < CObjectType type_t >
-	static void Preload( const TArray< TSoftClassPtr< type_t > > &SoftPaths );
+	static void Preload( const TArray< TSoftClassPtr< type_t > > &SoftPaths, TAsyncLoadPriority Priority = PreloaderPriority );
 
 private:
 	// The game instances that are active and using the preloaded assets
 	// Assets are kept loaded as long as there is at least one element in the array
 	static TArray< TStrongObjectPtr< const UGameInstance > > RefScopes;
-	// The collection of assets that developer settings need to have loaded
-	static TSet< FSoftObjectPath > PreloadedAssets;
+	// The collection of assets that developer settings need to have loaded, and the highest priority they were requested with
+	static TMap< FSoftObjectPath, TAsyncLoadPriority > PreloadedAssets;
+	// The priority of the preloader that is currently adding assets
+	static TAsyncLoadPriority CurrentPreloaderPriority;
 	// Handle that will keep the assets loaded until all game instances are shutdown
 	static TSharedPtr< FStreamableHandle > ResourcesHandle;
 };
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Misc/LatentAction_Simple.h"
+
+#include "Async/Future.h"
+
+#include <atomic>
+
+// Utility for making a simple latent action that completes when something else signals it (a delegate, a future, etc)
+// instead of polling for completion each frame
+class STARFIREUTILITIES_API FLatentAction_Event : public FLatentAction_Simple
+{
+public:
+
+	// Shared state for signaling the action. Safe to signal from any thread and safe to outlive the action
+	class FTrigger
+	{
+	public:
+		// Mark the action as complete. It will finish during its next update
+		void Signal( void ) { bSignaled.store( true, std::memory_order_release ); }
+
+		// Check if the action has been signaled
+		[[nodiscard]] bool IsSignaled( void ) const { return bSignaled.load( std::memory_order_acquire ); }
+
+	private:
+		std::atomic< bool > bSignaled = false;
+	};
+
+	using FTriggerPtr = TSharedPtr< FTrigger, ESPMode::ThreadSafe >;
+	using FTriggerRef = TSharedRef< FTrigger, ESPMode::ThreadSafe >;
+
+	// Delegate signature for the action to execute on completion
+	DECLARE_DELEGATE( OnFinishDelegate );
+
+	// Create and add a new FLatentAction_Event to the FLatentActionManager. The action will complete once the returned trigger is signaled. Then it will execute OnFinished
+	// Returns nullptr if the action couldn't be created (or already exists)
+	[[nodiscard]] static FTriggerPtr Create( const UObject* WorldContextObject, const FLatentActionInfo &LatentInfo, const OnFinishDelegate &OnFinished = OnFinishDelegate( ) );
+
+	// Create and add a new FLatentAction_Event to the FLatentActionManager. The action will complete once the future has a result. Then it will execute OnFinished
+	template < class type_t >
+	static bool Create( const UObject* WorldContextObject, const FLatentActionInfo &LatentInfo, TFuture< type_t > &&Future, const OnFinishDelegate &OnFinished = OnFinishDelegate( ) );
+
+	// Create a delegate that signals a trigger, for binding to other delegates or events with no parameters
+	[[nodiscard]] static FSimpleDelegate MakeSignalDelegate( const FTriggerPtr &Trigger );
+
+	explicit FLatentAction_Event( const FLatentActionInfo &LatentInfo, const FTriggerRef &InTrigger );
+	~FLatentAction_Event( ) override = default;
+
+protected:
+	ELatentActionResponse Update( void ) override;
+
+	// The state that is signaled externally to complete the action
+	FTriggerRef Trigger;
+
+	// Delegate for processing the execution
+	OnFinishDelegate OnFinished;
+};
+
+#define __LATENT_ACTION_EVENT_IMPLEMENTATION
+	#include "../../Private/Misc/LatentAction_Event.hpp"
+#undef __LATENT_ACTION_EVENT_IMPLEMENTATION
@@ -2,8 +2,11 @@
 #pragma once
 
 #include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
 #include "Templates/SubsystemNativeAccessors.h"
 
+#include <atomic>
+
 #include "SplatTaskManager.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN( LogSplatTaskManager, Log, All );
@@ -18,23 +21,95 @@ enum class ESplatTaskResult
 	Complete,	// remove the entire task from the process because it's finished
 };
 
+// How important a task is relative to the other tasks when sharing the manager's frame budget
+// The value is the task's scheduling weight
+enum class ESplatTaskPriority : uint8
+{
+	Low = 1,
+	Normal = 2,
+	High = 4,
+};
+
 // Identifier for a splatted task to refer back to it later
+// Handles are only meaningful to the manager that returned them and become stale once the task is removed,
+// other managers (or a new manager after a world change) will not resolve them
 struct FSplatTaskHandle
 {
 	// Does the handle reference a valid task
-	bool IsValid( ) const { return Handle > 0; }
+	bool IsValid( ) const { return Generation > 0; }
 	
 	// Comparison operator
-	bool operator==( const FSplatTaskHandle &rhs ) const { return Handle == rhs.Handle; }
+	bool operator==( const FSplatTaskHandle &rhs ) const { return (Index == rhs.Index) && (Generation == rhs.Generation); }
+
+	// Debug string for the handle
+	FString ToString( ) const { return FString::Printf( TEXT( "%d:%u" ), Index, Generation ); }
 	
 private:
 	friend class USplatTaskManager;
 
-	// Static data for creating a unique value to use as a handle
-	inline static int RollingID = 1;
+	// The slot in the manager where the task is stored
+	int Index = INDEX_NONE;
 
-	// Unique identifier for this handle
-	int Handle = 0;
+	// The generation of the slot when the task was stored, so that handles to a task are stale once the slot is reused
+	// Generations come from a counter shared by all managers so they can't alias a task in another manager
+	uint32 Generation = 0;
+};
+
+// Measurements of how a splatted task has behaved while sharing the frame with other tasks
+struct STARFIREUTILITIES_API FSplatTaskStats
+{
+	// The frame the task was started (or restarted) on
+	uint64 StartFrame = 0;
+	// The number of frames it took the task to get through all of its work, 0 if it hasn't finished yet
+	uint64 FramesToCompletion = 0;
+
+	// The number of frames that the task was able to step
+	int FramesStepped = 0;
+	// The number of steps taken across all frames
+	int64 TotalSteps = 0;
+	// The number of steps taken during the last frame the task stepped
+	int LastFrameSteps = 0;
+	// The most steps taken during any single frame
+	int PeakFrameSteps = 0;
+
+	// The amount of time spent stepping the task across all frames
+	double TotalTime_s = 0.0;
+	// The amount of time spent stepping the task during the last frame it stepped
+	double LastFrameTime_s = 0.0;
+	// The most time spent stepping the task during any single frame
+	double PeakFrameTime_s = 0.0;
+	// The number of frames the task went over its own MaxTimePerFrame
+	int OverBudgetFrames = 0;
+
+	// The number of times the task gave up the rest of its frame
+	int YieldCount = 0;
+
+	// The number of frames the task wanted to step but the frame budget was used up by other tasks
+	int FramesStarved = 0;
+	// The most frames in a row the task was starved
+	int PeakFramesStarved = 0;
+
+	// Update the stats after a frame where the task stepped
+	void RecordFrame( int Steps, double Time_s, double MaxTimePerFrame_s, bool bYielded );
+};
+
+// A copy of the information about a splatted task at a moment in time
+struct FSplatTaskSnapshot
+{
+	// The task this is a snapshot of
+	FSplatTaskHandle Handle;
+	// The name provided for the task, if one was
+	FName DebugName;
+	// The priority the task was started with
+	ESplatTaskPriority Priority = ESplatTaskPriority::Normal;
+	// The per-frame limits the task was started with
+	int MaxCountPerFrame = -1;
+	double MaxTimePerFrame_s = -1;
+	// Whether the task was paused
+	bool bPaused = false;
+
+	// The task's measurements
+	FSplatTaskStats Stats;
 };
 
 // Since concepts can't be in a class scope, they'll just be namespaced instead
@@ -53,10 +128,29 @@ namespace SplatTaskManager
 	{
 		{ Task( ) } -> std::same_as< ESplatTaskResult >;
 	};
+
+	// A concept for a functor which computes a result from an element without modifying it, for use on worker threads
+	template < class task_t, class type_t >
+	concept CallableParallelTask = requires( const task_t Task, const type_t &Element )
+	{
+		{ Task( Element ) };
+	};
+
+	// The type of result computed by a parallel task
+	template < class task_t, class type_t >
+	using TParallelTaskResult = std::decay_t< std::invoke_result_t< const task_t&, const type_t& > >;
+
+	// A concept for a functor which applies the result of a parallel task back to the element it was computed from
+	template < class task_t, class type_t, class result_t >
+	concept CallableFinalizeTask = requires( task_t Task, type_t &Element, result_t &Result )
+	{
+		{ Task( Element, Result ) } -> std::same_as< ESplatTaskResult >;
+	};
 }
 
 // System for handling asynchronous task splatted across multiple frames
 // with support for limitations on the maximum number of iterations or maximum amount of time to spend each from 
+// All the tasks share a frame budget, with tasks scheduled by priority and by how long they've been waiting
 UCLASS( )
 class STARFIREUTILITIES_API USplatTaskManager : public UTickableWorldSubsystem, public TSubsystemNativeAccessors< USplatTaskManager >
 {
@@ -67,20 +161,59 @@ public:
 	// MaxTimePerFrame <= 0.0 results in only being bound by MaxCountPerFrame
 	// At least one limiter must be greater than 0
 	template < class type_t, SplatTaskManager::CallableDataTask< type_t > task_t >
-	FSplatTaskHandle StartTask( TArray< type_t > &Data, task_t &&SplatTask, int MaxCountPerFrame = 1, double MaxTimePerFrame_s = 0.0 );
+	FSplatTaskHandle StartTask( TArray< type_t > &Data, task_t &&SplatTask, int MaxCountPerFrame = 1, double MaxTimePerFrame_s = 0.0, ESplatTaskPriority Priority = ESplatTaskPriority::Normal );
 
 	// Start a splatted task that is a single process, but should execute partial work within each frame
 	// MaxCountPerFrame <= 0 results in only being bound by MaxTimePerFrame
 	// MaxTimePerFrame <= 0.0 results in only being bound by MaxCountPerFrame
 	// At least one limiter must be greater than 0
 	template < SplatTaskManager::CallableTask task_t >
-	FSplatTaskHandle StartTask( task_t &&SplatTask, int MaxCountPerFrame = 1, double MaxTimePerFrame_s = 0.0 );
+	FSplatTaskHandle StartTask( task_t &&SplatTask, int MaxCountPerFrame = 1, double MaxTimePerFrame_s = 0.0, ESplatTaskPriority Priority = ESplatTaskPriority::Normal );
+
+	// Start a splatted task that processes chunks of a collection on worker threads in parallel
+	// WorkTask must be thread safe, it's given each element as const and returns a result to apply later
+	// FinalizeTask is called on the game thread for each element (in order) with its result, once the chunk containing it is done
+	// MaxCountPerFrame & MaxTimePerFrame limit the finalize step the same way they do for other collection tasks
+	// Elements the finalize step removes are removed once the entire collection has been finalized
+	// Nothing else should change the collection while the task is running
+	template < class type_t, SplatTaskManager::CallableParallelTask< type_t > work_t, SplatTaskManager::CallableFinalizeTask< type_t, SplatTaskManager::TParallelTaskResult< work_t, type_t > > finalize_t >
+	FSplatTaskHandle StartParallelTask( TArray< type_t > &Data, work_t &&WorkTask, finalize_t &&FinalizeTask, int MaxCountPerFrame = 1, double MaxTimePerFrame_s = 0.0, int ChunkSize = 64, ESplatTaskPriority Priority = ESplatTaskPriority::Normal );
 
 	// Restart a collection based task from the beginning of the collection
+	// If called by the task itself, the restart happens once its current step is done
 	void RestartTask( const FSplatTaskHandle &Handle );
 
 	// Remove a task from the system so that it is no longer ticking
+	// Safe to call from within any task, including the one being removed
 	void RemoveTask( FSplatTaskHandle &Handle );
+
+	// Stop a task from stepping until it is resumed
+	void PauseTask( const FSplatTaskHandle &Handle );
+
+	// Allow a paused task to continue stepping
+	void ResumeTask( const FSplatTaskHandle &Handle );
+
+	// Check if a handle still refers to a task that hasn't been removed
+	[[nodiscard]] bool IsTaskValid( const FSplatTaskHandle &Handle ) const;
+
+	// Check if a task has been paused
+	[[nodiscard]] bool IsTaskPaused( const FSplatTaskHandle &Handle ) const;
+
+	// Provide a name for a task to identify it in the telemetry and any warnings
+	void SetTaskName( const FSplatTaskHandle &Handle, FName DebugName );
+
+	// Get the current telemetry for all the running tasks as well as the most recently finished ones
+	void GetTaskSnapshots( TArray< FSplatTaskSnapshot > &OutActive, TArray< FSplatTaskSnapshot > &OutFinished ) const;
+
+	// Write the current telemetry to an output device (the log or console)
+	void DumpTaskSnapshots( FOutputDevice &Ar ) const;
+
+	// Set the maximum amount of time all tasks combined may use each frame, overriding the Starfire.SplatTasks.FrameBudgetMs console variable
+	// FrameBudget_s <= 0.0 reverts to using the console variable
+	void SetFrameBudget( double FrameBudget_s );
+
+	// Get the maximum amount of time all tasks combined may use each frame, <= 0.0 when unlimited
+	[[nodiscard]] double GetFrameBudget( void ) const;
 	
 	// Tickable Game Object API
 	void Tick( float DeltaTime ) override;
@@ -105,9 +238,28 @@ protected:
 		// The amount of time below which additional steps of the task are allowed
 		double MaxTimePerFrame_s = -1;
 
+		// How important this task is relative to the other tasks
+		ESplatTaskPriority Priority = ESplatTaskPriority::Normal;
+
+		// The number of frames in a row this task wanted to step but the frame budget was used up by other tasks
+		int FramesWaiting = 0;
+
+		// Whether the task has been paused and shouldn't step until it's resumed
+		bool bPaused = false;
+		// Whether the task has been removed but couldn't be deleted yet because the manager is ticking
+		bool bRemoved = false;
+		// Whether the task asked to be restarted while it was stepping
+		bool bRestartRequested = false;
+
 		// The unique ID for this task
 		FSplatTaskHandle Handle;
 
+		// The name provided for the task, if one was
+		FName DebugName;
+
+		// Measurements of how the task has been behaving
+		FSplatTaskStats Stats;
+
 		// Determine if the task should even bother to be stepped
 		virtual bool ShouldStep( void ) const { return true; }
 
@@ -155,14 +307,103 @@ protected:
 		void Restart( void ) override;
 	};
 
+	// Task structure for collection tasks where the expensive part of processing each element happens on worker threads
+	// and only applying the results happens on the game thread as part of the regular splatting
+	template < class type_t, class result_t, class work_t, class finalize_t >
+	struct TSplatTask_ParallelData : public FSplatTaskBase
+	{
+		static_assert( std::is_default_constructible_v< result_t >, "Parallel splat task results must be default constructible" );
+
+		TSplatTask_ParallelData( TArray< type_t > &D, work_t &&W, finalize_t &&F, int InChunkSize );
+		~TSplatTask_ParallelData( ) override;
+
+		// The number of elements that each worker task processes
+		int ChunkSize = 1;
+		// The location in the collection that we are currently finalizing
+		int CurrentIdx = 0;
+
+		// The data set that is being processed by the task
+		TArray< type_t > &Data;
+		// The task to use to compute the result for each element of the collection
+		work_t WorkTask;
+		// The task to use to apply the result for each element of the collection
+		finalize_t FinalizeTask;
+
+		// The results computed by the worker tasks, one for each element of the collection
+		TArray< result_t > Results;
+		// The worker tasks, one for each chunk of the collection
+		TArray< UE::Tasks::FTask > ChunkTasks;
+		// The elements that finalizing requested be removed, which can't happen while the worker tasks are still reading the collection
+		TArray< int > PendingRemovals;
+		// Flag to let worker tasks stop early because the results are no longer needed
+		std::atomic< bool > bCancelled = false;
+
+		bool ShouldStep( void ) const override;
+
+		ESplatTaskResult StepTask( void ) override;
+
+		void Restart( void ) override;
+
+		// Start the worker tasks for every chunk of the collection
+		void LaunchChunks( void );
+
+		// Stop any worker tasks that are in progress, blocking until they have
+		void CancelChunks( void );
+
+		// Remove the elements that were requested to be removed while finalizing
+		void ApplyRemovals( void );
+	};
+
 	// Internal utility to register new tasks to tick
 	void StartTask_Internal( FSplatTaskBase *NewTask );
 
-	// Check if a task should step considering the number of times it's 
-	static bool ShouldStep( const FSplatTaskBase *Task, int Count, double StartTime );
+	// Find the task a handle refers to, nullptr if the handle is stale
+	FSplatTaskBase* FindTask( const FSplatTaskHandle &Handle ) const;
+
+	// Return a task to the start state and reset the telemetry tracking it's progress
+	static void RestartTask_Internal( FSplatTaskBase *Task );
+
+	// Remove a task from its slot, deleting it immediately or once it's safe to do so
+	void ReleaseTask( FSplatTaskBase *Task );
+
+	// Check if a task should step considering the number of times it's stepped, its own time limit and the frame budget
+	static bool ShouldStep( const FSplatTaskBase *Task, int Count, double StartTime, double FrameEndTime );
+
+	// The order to consider the tasks in, higher priority tasks first but boosted by the time they have been waiting
+	static double GetSchedulingWeight( const FSplatTaskBase *Task );
+
+	// Copy the current information about a task
+	static FSplatTaskSnapshot MakeSnapshot( const FSplatTaskBase *Task );
+
+	// Keep the telemetry of a task that is about to be removed
+	void RecordFinishedTask( const FSplatTaskBase *Task );
+
+	// Storage for a task along with the generation used to validate handles to it
+	struct FSplatTaskSlot
+	{
+		// The task in the slot, nullptr if the slot is free
+		FSplatTaskBase *Task = nullptr;
+		// Unique across every manager while the slot holds a task, 0 if the slot is free
+		uint32 Generation = 0;
+	};
+
+	// Collection of tasks that are being ticked, sparse with free slots reused for new tasks
+	TArray< FSplatTaskSlot > Slots;
+	// The indices of Slots that don't have a task in them
+	TArray< int > FreeSlots;
+
+	// Tasks that were removed while the manager was ticking, deleted at the end of the tick
+	TArray< FSplatTaskBase* > PendingDeletes;
+	// The task that is currently taking a step
+	FSplatTaskBase *SteppingTask = nullptr;
+	// Whether the manager is in the middle of ticking tasks
+	bool bTicking = false;
+
+	// Frame budget set directly on this manager, instead of the console variable
+	double FrameBudgetOverride_s = 0.0;
 
-	// Collection of tasks that are being ticked
-	TArray< FSplatTaskBase* > Tasks;
+	// Telemetry for the most recent tasks that have been removed, oldest first
+	TArray< FSplatTaskSnapshot > FinishedTasks;
 };
 
 #if CPP
@@ -11,9 +11,25 @@ protected:
 	[[nodiscard]] static const UWorld* GetWorldFromContext( const UObject *WorldContext );
 
 	[[nodiscard]] static AActor* GetActorSingleton( const UWorld *World, const TSubclassOf< AActor > &SingletonType );
+
+	// Add a singleton to the registry for its world so that it can be found without searching the world's actors
+	// Should be called from the singleton's BeginPlay
+	static void RegisterActorSingleton( AActor *Singleton );
+
+	// Remove a singleton from the registry for its world
+	// Should be called from the singleton's EndPlay
+	static void UnregisterActorSingleton( AActor *Singleton );
+
+private:
+	friend class FStarfireUtilities;
+
+	// Release the registry and the callbacks it has bound, on module shutdown
+	static void ShutdownRegistry( void );
 };
 
 // Mixin template CRTP that adds static GetSingleton member functions to the class for simpler access
+// Singletons that call RegisterActorSingleton/UnregisterActorSingleton from BeginPlay/EndPlay are found with a lookup,
+// otherwise the first lookup has to search the world for the singleton
 template < class type_t >
 struct TActorSingletonAccessors : public FActorSingletonAccessorsBase
 {
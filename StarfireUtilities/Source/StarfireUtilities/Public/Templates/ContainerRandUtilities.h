@@ -1,6 +1,8 @@
 
 #pragma once
 
+#include "Math/RandomStream.h"
+
 // collection of utilities for random operations on containers
 namespace ContainerRand
 {
@@ -9,6 +11,17 @@ namespace ContainerRand
 		requires requires( container_t C) { { C.Num( ) } -> std::same_as< int >; C.Swap( int( ), int( ) ); }
 	void Shuffle( container_t &Container );
 
+	// Partially shuffle a container with a fisher-yates, stopping once the first Count elements are a random selection in a random order
+	// Cheaper than a full shuffle when only the first few elements will be used
+	template < class container_t >
+		requires requires( container_t C) { { C.Num( ) } -> std::same_as< int >; C.Swap( int( ), int( ) ); }
+	void PartialShuffle( container_t &Container, int Count );
+
+	// Select Count distinct elements from an array, in a random order, without modifying the array
+	// Only does work proportional to Count, instead of the size of the array
+	template < class type_t >
+	TArray< type_t > RandSample( const TArray< type_t > &Container, int Count );
+
 	// Select a random element from an array
 	// TODO: get this working with a requires clause - first tries couldn't narrow this version to TArray vs TMap/TSet
 	template < class type_t >
@@ -28,7 +41,36 @@ namespace ContainerRand
 	template < class container_t >
 		requires requires( container_t C) { { C.Num( ) } -> std::same_as< int >; C.CreateIterator( ); ++C.CreateIterator( ); C.CreateIterator( ).RemoveCurrent( ); }
 	auto RandRemove( container_t &Container );
-;
+
+	// Table for selecting random indices in proportion to a set of weights in constant time (using Vose's alias method)
+	// Building the table is linear in the number of weights, so it should be built once and reused for as many selections as needed
+	struct STARFIREUTILITIES_API FWeightedSelector
+	{
+		FWeightedSelector( ) = default;
+		explicit FWeightedSelector( TConstArrayView< float > Weights );
+
+		// Replace the table with one for a new set of weights, weights <= 0 are never selected
+		void Build( TConstArrayView< float > Weights );
+
+		// Select a random index in proportion to the weights the table was built from
+		[[nodiscard]] int Select( void ) const;
+		[[nodiscard]] int Select( const FRandomStream &Stream ) const;
+
+		// Check if there is anything that can be selected (at least one weight > 0)
+		[[nodiscard]] bool IsEmpty( void ) const { return Probabilities.IsEmpty( ); }
+
+		// The number of weights the table was built from
+		[[nodiscard]] int Num( void ) const { return Probabilities.Num( ); }
+
+	private:
+		// Pick from a column of the table with the random values already chosen
+		[[nodiscard]] int Select( int Column, float Roll ) const;
+
+		// The chance of selecting the index of each column instead of its alias
+		TArray< float > Probabilities;
+		// The other index that each column can select
+		TArray< int > Aliases;
+	};
 }
 
 #define CONTAINER_RAND_UTILITIES_HPP